@@ -6,7 +6,7 @@
 //------------------------------------------------------------------------------
 // Constructor
 //------------------------------------------------------------------------------
-Allocator::Allocator(size_t size, UINT objects, CHAR* memory, const CHAR* name) :
+Allocator::Allocator(size_t size, UINT objects, CHAR* memory, const CHAR* name, BOOL lockFree) :
     m_blockSize(size < sizeof(long*) ? sizeof(long*):size),
     m_objectSize(size),
     m_maxObjects(objects),
@@ -14,9 +14,13 @@ Allocator::Allocator(size_t size, UINT objects, CHAR* memory, const CHAR* name)
     m_poolIndex(0),
     m_blockCnt(0),
     m_blocksInUse(0),
+    m_maxBlocksInUse(0),
     m_allocations(0),
     m_deallocations(0),
-    m_name(name)
+    m_name(name),
+    m_lockFree(lockFree),
+    m_freeHead(0),
+    m_links(NULL)
 {
     // If using a fixed memory pool 
 	if (m_maxObjects)
@@ -35,6 +39,17 @@ Allocator::Allocator(size_t size, UINT objects, CHAR* memory, const CHAR* name)
 	}
 	else
 		m_allocatorMode = HEAP_BLOCKS;
+
+	// A lock-free allocator can't grow, so put the whole pool on the free-list 
+	if (m_lockFree)
+	{
+		assert(m_maxObjects != 0);
+		m_links = new std::atomic<UINT>[m_maxObjects];
+		for (UINT i = 0; i < m_maxObjects; i++)
+			m_links[i].store(i + 1 < m_maxObjects ? i + 2 : 0, std::memory_order_relaxed);
+		m_freeHead.store(1, std::memory_order_relaxed);
+		m_poolIndex = m_maxObjects;
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -51,40 +66,50 @@ Allocator::~Allocator()
 		while(m_pHead)
 			delete [] (CHAR*)Pop();
 	}
+	delete [] m_links;
 }
 
 //------------------------------------------------------------------------------
 // Allocate
 //------------------------------------------------------------------------------
 void* Allocator::Allocate(size_t size)
+{
+    void* pBlock = TryAllocate(size);
+    if (!pBlock)
+    {
+        // Get the pointer to the new handler
+        std::new_handler handler = std::set_new_handler(0);
+        std::set_new_handler(handler);
+
+        // If a new handler is defined, call it
+        if (handler)
+            (*handler)();
+        else
+            assert(0);
+    }
+    return pBlock;
+}
+
+//------------------------------------------------------------------------------
+// TryAllocate
+//------------------------------------------------------------------------------
+void* Allocator::TryAllocate(size_t size)
 {
     assert(size <= m_objectSize);
 	
     // If can't obtain existing block then get a new one
-    void* pBlock = Pop();
+    void* pBlock = m_lockFree ? PopLockFree() : Pop();
     if (!pBlock)
     {
         // If using a pool method then get block from pool,
         // otherwise using dynamic so get block from heap
         if (m_maxObjects)
         {
-            // If we have not exceeded the pool maximum
-            if(m_poolIndex < m_maxObjects)
-            {
-                pBlock = (void*)(m_pPool + (m_poolIndex++ * m_blockSize));
-            }
-            else
-            {
-                // Get the pointer to the new handler
-                std::new_handler handler = std::set_new_handler(0);
-                std::set_new_handler(handler);
-
-                // If a new handler is defined, call it
-                if (handler)
-                    (*handler)();
-                else
-                    assert(0);
-            }
+            // If we have exceeded the pool maximum. A lock-free pool is 
+            // entirely on the free-list, so is exhausted once the pop fails.
+            if(m_poolIndex >= m_maxObjects)
+                return NULL;
+            pBlock = (void*)(m_pPool + (m_poolIndex++ * m_blockSize));
         }
         else
         {
@@ -93,8 +118,13 @@ void* Allocator::Allocate(size_t size)
         }
     }
 
-    m_blocksInUse++;
-    m_allocations++;
+    // Track the high-water mark
+    UINT inUse = Count(m_blocksInUse, 1);
+    UINT maxInUse = m_maxBlocksInUse.load(std::memory_order_relaxed);
+    while (inUse > maxInUse && !m_maxBlocksInUse.compare_exchange_weak(maxInUse, inUse, 
+        std::memory_order_relaxed))
+        ;
+    Count(m_allocations, 1);
 	
     return pBlock;
 }
@@ -104,9 +134,12 @@ void* Allocator::Allocate(size_t size)
 //------------------------------------------------------------------------------
 void Allocator::Deallocate(void* pBlock)
 {
-    Push(pBlock);
-	m_blocksInUse--;
-	m_deallocations++;
+	if (m_lockFree)
+		PushLockFree(pBlock);
+	else
+		Push(pBlock);
+	Count(m_blocksInUse, -1);
+	Count(m_deallocations, 1);
 }
 
 //------------------------------------------------------------------------------
@@ -135,7 +168,56 @@ void* Allocator::Pop()
     return (void*)pBlock;
 }
 
+//------------------------------------------------------------------------------
+// PushLockFree
+//------------------------------------------------------------------------------
+void Allocator::PushLockFree(void* pMemory)
+{
+    UINT index = (UINT)(((CHAR*)pMemory - m_pPool) / m_blockSize);
+    UINT64 head = m_freeHead.load(std::memory_order_relaxed);
+    UINT64 newHead;
+    do
+    {
+        // Link to the current top then make the block the top with a new tag.
+        // Release publishes the link, and the client's writes to the block, to
+        // the thread that pops it.
+        m_links[index].store((UINT)head, std::memory_order_relaxed);
+        newHead = ((head >> 32) + 1) << 32 | (index + 1);
+    } while (!m_freeHead.compare_exchange_weak(head, newHead, 
+        std::memory_order_release, std::memory_order_relaxed));
+}
 
+//------------------------------------------------------------------------------
+// PopLockFree
+//------------------------------------------------------------------------------
+void* Allocator::PopLockFree()
+{
+    UINT64 head = m_freeHead.load(std::memory_order_acquire);
+    for (;;)
+    {
+        UINT top = (UINT)head;
+        if (top == 0)
+            return NULL;
 
+        // The link may be stale if another thread pops this block first, in 
+        // which case the tag has changed and the compare-and-swap fails
+        UINT next = m_links[top - 1].load(std::memory_order_relaxed);
+        UINT64 newHead = ((head >> 32) + 1) << 32 | next;
+        if (m_freeHead.compare_exchange_weak(head, newHead, 
+            std::memory_order_acquire, std::memory_order_acquire))
+            return (void*)(m_pPool + (top - 1) * m_blockSize);
+    }
+}
 
+//------------------------------------------------------------------------------
+// Count
+//------------------------------------------------------------------------------
+UINT Allocator::Count(std::atomic<UINT>& counter, INT delta)
+{
+    if (m_lockFree)
+        return counter.fetch_add(delta, std::memory_order_relaxed) + delta;
 
+    UINT value = counter.load(std::memory_order_relaxed) + delta;
+    counter.store(value, std::memory_order_relaxed);
+    return value;
+}
@@ -3,6 +3,7 @@
 
 #include "DataTypes.h"
 #include <stddef.h>
+#include <atomic>
 
 /// @see https://github.com/endurodave/Allocator
 /// David Lafreniere
@@ -17,7 +18,10 @@ public:
 	///		to obtain memory from global heap. If not NULL, the objects argument 
 	///		defines the size of the memory block (size x objects = memory size in bytes).
 	///	@param[in]	name - optional allocator name string.
-    Allocator(size_t size, UINT objects=0, CHAR* memory = NULL, const CHAR* name=NULL);
+	///	@param[in]	lockFree - if TRUE, Allocate() and Deallocate() may be called from
+	///		any thread without a lock. The free-list is a lock-free stack. Requires
+	///		a pool, i.e. objects must not be 0.
+    Allocator(size_t size, UINT objects=0, CHAR* memory = NULL, const CHAR* name=NULL, BOOL lockFree=FALSE);
 
     /// Destructor
     ~Allocator();
@@ -27,6 +31,12 @@ public:
     /// @return     Returns pointer to the block. Otherwise NULL if unsuccessful.
     void* Allocate(size_t size);
 
+    /// Get a pointer to a memory block without calling the new handler when a 
+    /// pool is exhausted. 
+    /// @param[in]  size - size of the block to allocate
+    /// @return     Returns pointer to the block. Otherwise NULL if the pool is exhausted.
+    void* TryAllocate(size_t size);
+
     /// Return a pointer to the memory pool. 
     /// @param[in]  pBlock - block of memory deallocate (i.e push onto free-list)
     void Deallocate(void* pBlock);
@@ -45,15 +55,28 @@ public:
 
     /// Gets the number of blocks in use.
     /// @return		The number of blocks in use by the application.
-    UINT GetBlocksInUse() { return m_blocksInUse; }
+    UINT GetBlocksInUse() { return m_blocksInUse.load(std::memory_order_relaxed); }
+
+    /// Gets the largest number of blocks in use at once.
+    /// @return		The high-water mark of blocks in use.
+    UINT GetMaxBlocksInUse() { return m_maxBlocksInUse.load(std::memory_order_relaxed); }
+
+    /// Returns TRUE if the block is from the allocator's fixed memory pool. 
+    /// @param[in]  pBlock - any memory block
+    BOOL Contains(const void* pBlock) { 
+        return m_maxObjects && (const CHAR*)pBlock >= m_pPool && 
+            (const CHAR*)pBlock < m_pPool + m_blockSize * m_maxObjects; }
 
     /// Gets the total number of allocations for this allocator instance.
     /// @return		The total number of allocations.
-    UINT GetAllocations() { return m_allocations; }
+    UINT GetAllocations() { return m_allocations.load(std::memory_order_relaxed); }
 
     /// Gets the total number of deallocations for this allocator instance.
     /// @return		The total number of deallocations.
-    UINT GetDeallocations() { return m_deallocations; }
+    UINT GetDeallocations() { return m_deallocations.load(std::memory_order_relaxed); }
+
+    /// Returns TRUE if the allocator may be used from any thread without a lock.
+    BOOL IsLockFree() { return m_lockFree; }
 	
 private:
     /// Push a memory block onto head of free-list.
@@ -64,6 +87,19 @@ private:
     /// @return     Returns pointer to the block. Otherwise NULL if unsuccessful.
     void* Pop();
 
+    /// Push a memory block onto the lock-free free-list.
+    /// @param[in]  pMemory - block of memory to push onto free-list
+    void PushLockFree(void* pMemory);
+
+    /// Pop a memory block from the lock-free free-list.
+    /// @return     Returns pointer to the block. Otherwise NULL if the pool is exhausted.
+    void* PopLockFree();
+
+    /// Add to a statistics counter. Lock-free allocators need an atomic 
+    /// read-modify-write, otherwise the caller's lock serializes access.
+    /// @return     The new counter value.
+    UINT Count(std::atomic<UINT>& counter, INT delta);
+
     struct Block
     {
         Block* pNext;
@@ -79,18 +115,30 @@ private:
     CHAR* m_pPool;
     UINT m_poolIndex;
     UINT m_blockCnt;
-    UINT m_blocksInUse;
-    UINT m_allocations;
-    UINT m_deallocations;
+    std::atomic<UINT> m_blocksInUse;
+    std::atomic<UINT> m_maxBlocksInUse;
+    std::atomic<UINT> m_allocations;
+    std::atomic<UINT> m_deallocations;
     const CHAR* m_name;
+
+    /// Lock-free mode only. The free-list head: the index + 1 of the top block in
+    /// the lower 32 bits, 0 if empty, and a tag incremented by every push and pop 
+    /// in the upper 32 bits. The tag makes a stale compare-and-swap fail (ABA).
+    const BOOL m_lockFree;
+    std::atomic<UINT64> m_freeHead;
+
+    /// Lock-free mode only. For each block, the index + 1 of the next free block.
+    /// Kept outside the blocks so a pop reading a link never races with a client
+    /// writing to a block another thread just popped.
+    std::atomic<UINT>* m_links;
 };
 
 // Template class to create external memory pool
-template <class T, UINT Objects>
+template <class T, UINT Objects, BOOL LockFree = FALSE>
 class AllocatorPool : public Allocator
 {
 public:
-	AllocatorPool() : Allocator(sizeof(T), Objects, m_memory)
+	AllocatorPool() : Allocator(sizeof(T), Objects, m_memory, NULL, LockFree)
 	{
 	}
 private:
@@ -113,6 +161,11 @@ private:
 #define IMPLEMENT_ALLOCATOR(class, objects, memory) \
 	Allocator class::_allocator(sizeof(class), objects, memory, #class);
 
+// macro to provide source file interface for a class whose instances are created
+// and deleted on any thread without a lock. objects must not be 0. 
+#define IMPLEMENT_LOCK_FREE_ALLOCATOR(class, objects, memory) \
+	Allocator class::_allocator(sizeof(class), objects, memory, #class, TRUE);
+
 #endif
 
 
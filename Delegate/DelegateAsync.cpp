@@ -1,9 +0,0 @@
-#include "DelegateAsync.h"
-
-namespace DelegateLib {
-
-DelegateFreeAsync0 MakeDelegate(void (*func)(), DelegateThread* thread) { 
-	return DelegateFreeAsync0(func, thread);
-}
-
-}
\ No newline at end of file
@@ -0,0 +1,598 @@
+#include "DelegateOpt.h"
+
+#if DELEGATE_BENCHMARKS
+
+// Throughput benchmarks. Results are printed to stdout; nothing is asserted
+// since timings depend on the host.
+
+#include "DelegateLib.h"
+#include "xallocator.h"
+#include "Allocator.h"
+#include <iostream>
+#if USE_STD_THREADS
+	#include "WorkerThreadStd.h"
+	#include "DelegateThreadPool.h"
+	#include "Timer.h"
+	#include <thread>
+	#include <vector>
+	#include <chrono>
+	#include <mutex>
+	#include <atomic>
+	#include <algorithm>
+	#include <memory>
+	#include <cstring>
+#endif
+
+using namespace DelegateLib;
+
+#if USE_STD_THREADS
+static void BenchNoop(int) { }
+
+static void BenchProducer(WorkerThread* thread, int msgs)
+{
+	DelegateFreeAsync1<int> delegate = MakeDelegate(&BenchNoop, thread);
+	for (int i = 0; i < msgs; i++)
+		delegate(i);
+}
+
+/// Time bursty producers flooding one worker thread until the queue drains.
+/// @return Messages per second.
+static double DispatchThroughput(WorkerThread& thread, int producerCnt, int msgsPerProducer)
+{
+	DelegateFreeAsyncWait1<int, void> flush = MakeDelegate(&BenchNoop, &thread, WAIT_INFINITE);
+
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> producers;
+	for (int i = 0; i < producerCnt; i++)
+		producers.push_back(std::thread(&BenchProducer, &thread, msgsPerProducer));
+	for (size_t i = 0; i < producers.size(); i++)
+		producers[i].join();
+	flush(0);
+
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	return (producerCnt * msgsPerProducer) / elapsed.count();
+}
+
+static void BatchDrainBenchmark()
+{
+	const int PRODUCERS = 4;
+	const int MSGS = 50000;
+	const UINT drains[] = { 1, 64, 0 };
+
+	std::cout << "WorkerThread dispatch throughput, " << PRODUCERS << " producers x " << MSGS << " msgs" << std::endl;
+	for (size_t i = 0; i < sizeof(drains) / sizeof(drains[0]); i++)
+	{
+		WorkerThread thread("BatchDrainBenchmark");
+		thread.SetBatchDrain(drains[i]);
+		thread.CreateThread();
+		double rate = DispatchThroughput(thread, PRODUCERS, MSGS);
+		thread.ExitThread();
+
+		std::cout << "  QUEUE_LOCKED    batch " << drains[i] << ": " << (long)rate << " msgs/sec" << std::endl;
+	}
+
+	WorkerThread lockFree("BatchDrainBenchmark", WorkerThread::QUEUE_LOCK_FREE);
+	lockFree.CreateThread();
+	double rate = DispatchThroughput(lockFree, PRODUCERS, MSGS);
+	lockFree.ExitThread();
+	std::cout << "  QUEUE_LOCK_FREE        : " << (long)rate << " msgs/sec" << std::endl;
+}
+
+static std::atomic<int> floodOutstanding(0);
+
+// Low priority busy work used to flood the worker thread
+static void PriorityFloodFunc()
+{
+	auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(20);
+	while (std::chrono::steady_clock::now() < end)
+		;
+	floodOutstanding--;
+}
+
+/// Measure the round trip of blocking probe calls while the worker thread is 
+/// kept flooded with low priority messages. 
+/// @return The 99th percentile latency in microseconds.
+static long PriorityProbeLatency(WorkerThread& thread, DelegatePriority probePriority)
+{
+	const int FLOOD_DEPTH = 500;
+	const int PROBES = 50;
+	std::atomic<bool> stop(false);
+
+	std::thread producer([&thread, &stop]() {
+		DelegateFreeAsync0 flood = MakeDelegate(&PriorityFloodFunc, &thread);
+		flood.SetPriority(PRIORITY_LOW);
+		while (!stop.load())
+		{
+			if (floodOutstanding.load() < FLOOD_DEPTH)
+			{
+				floodOutstanding++;
+				flood();
+			}
+			else
+				std::this_thread::yield();
+		}
+	});
+
+	// Let the flood build up
+	while (floodOutstanding.load() < FLOOD_DEPTH)
+		std::this_thread::yield();
+
+	DelegateFreeAsyncWait1<int, void> probe = MakeDelegate(&BenchNoop, &thread, WAIT_INFINITE);
+	probe.SetPriority(probePriority);
+	std::vector<long> latency;
+	for (int i = 0; i < PROBES; i++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		probe(0);
+		latency.push_back((long)std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start).count());
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	stop = true;
+	producer.join();
+
+	std::sort(latency.begin(), latency.end());
+	return latency[(latency.size() * 99) / 100];
+}
+
+/// Compare the latency of probes at the flood's priority, which wait behind
+/// the flood, with high priority probes, which wait for at most the message 
+/// being run.
+static void PriorityLatencyBenchmark()
+{
+	std::cout << "Priority probe p99 latency under a low priority flood" << std::endl;
+	for (int lockFree = 0; lockFree < 2; lockFree++)
+	{
+		WorkerThread thread("PriorityLatencyBenchmark", 
+			lockFree ? WorkerThread::QUEUE_LOCK_FREE : WorkerThread::QUEUE_LOCKED);
+		thread.CreateThread();
+		long baseline = PriorityProbeLatency(thread, PRIORITY_LOW);
+		long high = PriorityProbeLatency(thread, PRIORITY_HIGH);
+		thread.ExitThread();
+
+		std::cout << (lockFree ? "  QUEUE_LOCK_FREE" : "  QUEUE_LOCKED   ") << ": same priority " 
+			<< baseline << " us, high priority " << high << " us" << std::endl;
+	}
+}
+
+static void TimerBenchNoop() { }
+
+/// Time Timer::Start(), restart, Stop() and an idle service pass with many 
+/// active timers. Timeouts are long enough that none expire while measured.
+static void TimerBenchmark()
+{
+	const int TIMERS = 100000;
+	const int RESTARTS = 1000;
+	std::vector<Timer> timers(TIMERS);
+	for (int i = 0; i < TIMERS; i++)
+		timers[i].Expired = MakeDelegate(&TimerBenchNoop);
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < TIMERS; i++)
+		timers[i].Start(60000 + (i * 7919) % 3600000);
+	std::chrono::duration<double, std::nano> startNs = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < RESTARTS; i++)
+		timers[(i * 7919) % TIMERS].Start(120000);
+	std::chrono::duration<double, std::nano> restartNs = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < 100; i++)
+		Timer::ProcessTimers();
+	std::chrono::duration<double, std::nano> processNs = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < TIMERS; i++)
+		timers[i].Stop();
+	std::chrono::duration<double, std::nano> stopNs = std::chrono::steady_clock::now() - start;
+
+	std::cout << "Timer, " << TIMERS << " active timers" << std::endl;
+	std::cout << "  Start        : " << (long)(startNs.count() / TIMERS) << " ns/timer" << std::endl;
+	std::cout << "  Restart      : " << (long)(restartNs.count() / RESTARTS) << " ns/timer" << std::endl;
+	std::cout << "  Service pass : " << (long)(processNs.count() / 100) << " ns" << std::endl;
+	std::cout << "  Stop         : " << (long)(stopNs.count() / TIMERS) << " ns/timer" << std::endl;
+}
+
+static void FanOutVector(const std::vector<char>&) { }
+static void FanOutBuffer(const DelegateBuffer&) { }
+
+/// Time multicasting one large payload to several asynchronous subscribers, 
+/// deep copied per subscriber as a std::vector versus shared as a DelegateBuffer.
+static void FanOutBenchmark()
+{
+	const size_t SIZE = 4 * 1024 * 1024;
+	const int SUBSCRIBERS = 8;
+	const int LOOPS = 50;
+
+	WorkerThread thread("FanOutBenchmark");
+	thread.CreateThread();
+	DelegateFreeAsyncWait1<int, void> flush = MakeDelegate(&BenchNoop, &thread, WAIT_INFINITE);
+
+	MulticastDelegateSafe1<const std::vector<char>&> vectorMulticast;
+	MulticastDelegateSafe1<const DelegateBuffer&> bufferMulticast;
+	for (int i = 0; i < SUBSCRIBERS; i++) {
+		vectorMulticast += MakeDelegate(&FanOutVector, &thread);
+		bufferMulticast += MakeDelegate(&FanOutBuffer, &thread);
+	}
+
+	std::vector<char> vec(SIZE);
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < LOOPS; i++)
+		vectorMulticast(vec);
+	flush(0);
+	std::chrono::duration<double, std::micro> vectorUs = std::chrono::steady_clock::now() - start;
+
+	DelegateBuffer buffer(vec.data(), vec.size());
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < LOOPS; i++)
+		bufferMulticast(buffer);
+	flush(0);
+	std::chrono::duration<double, std::micro> bufferUs = std::chrono::steady_clock::now() - start;
+
+	thread.ExitThread();
+
+	std::cout << "Fan-out of " << SIZE / (1024 * 1024) << " MB to " << SUBSCRIBERS << " async subscribers" << std::endl;
+	std::cout << "  std::vector copy : " << (long)(vectorUs.count() / LOOPS) << " us/multicast" << std::endl;
+	std::cout << "  DelegateBuffer   : " << (long)(bufferUs.count() / LOOPS) << " us/multicast" << std::endl;
+}
+
+/// A payload too large to be held inside a message
+struct CoalescePayload
+{
+	char data[256];
+};
+
+static void CoalesceSubscriber(const CoalescePayload&) { }
+
+/// Time multicasting to asynchronous subscribers spread over a few threads, 
+/// with one message per subscriber and with one coalesced message per thread.
+static void CoalesceBenchmark()
+{
+	const int THREADS = 4;
+	const int SUBSCRIBERS = 32;
+	const int LOOPS = 2000;
+
+	std::vector<std::unique_ptr<WorkerThread> > threads;
+	std::vector<DelegateFreeAsyncWait1<int, void> > flushes;
+	for (int i = 0; i < THREADS; i++) {
+		threads.push_back(std::unique_ptr<WorkerThread>(new WorkerThread("CoalesceBenchmark")));
+		threads[i]->CreateThread();
+		flushes.push_back(MakeDelegate(&BenchNoop, threads[i].get(), WAIT_INFINITE));
+	}
+
+	MulticastDelegateSafe1<const CoalescePayload&> multicast;
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		multicast += MakeDelegate(&CoalesceSubscriber, threads[i % THREADS].get());
+
+	CoalescePayload payload;
+	memset(payload.data, 0, sizeof(payload.data));
+	double us[2];
+	for (int coalesce = 0; coalesce < 2; coalesce++) {
+		multicast.SetCoalesce(coalesce != 0);
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < LOOPS; i++) {
+			multicast(payload);
+
+			// Keep the queues short
+			if (i % 100 == 99)
+				flushes[i % THREADS](0);
+		}
+		for (int t = 0; t < THREADS; t++)
+			flushes[t](0);
+		std::chrono::duration<double, std::micro> elapsedUs = std::chrono::steady_clock::now() - start;
+		us[coalesce] = elapsedUs.count();
+	}
+
+	for (int i = 0; i < THREADS; i++)
+		threads[i]->ExitThread();
+
+	std::cout << "Multicast to " << SUBSCRIBERS << " async subscribers on " << THREADS << " threads" << std::endl;
+	std::cout << "  Message per subscriber : " << us[0] / LOOPS << " us/multicast" << std::endl;
+	std::cout << "  Message per thread     : " << us[1] / LOOPS << " us/multicast" << std::endl;
+}
+
+static void XallocWorker(int loops)
+{
+	const int BATCH = 16;
+	const size_t sizes[] = { 24, 48, 100, 200 };
+	void* blocks[BATCH];
+	for (int i = 0; i < loops; i++) {
+		for (int b = 0; b < BATCH; b++)
+			blocks[b] = xmalloc(sizes[(i + b) % 4]);
+		for (int b = 0; b < BATCH; b++)
+			xfree(blocks[b]);
+	}
+}
+
+/// Time xmalloc()/xfree() pairs from several threads at once.
+/// @return Allocations per second across all threads.
+static double XallocThroughput(int threadCnt, int loops)
+{
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for (int i = 0; i < threadCnt; i++)
+		threads.push_back(std::thread(&XallocWorker, loops));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	return (threadCnt * loops * 16) / elapsed.count();
+}
+
+static void XallocBenchmark()
+{
+	const int LOOPS = 50000;
+	const int threadCnts[] = { 1, 2, 4, 8 };
+
+	std::cout << "xallocator throughput, " << LOOPS * 16 << " xmalloc/xfree pairs per thread" << std::endl;
+	for (size_t i = 0; i < sizeof(threadCnts) / sizeof(threadCnts[0]); i++)
+		std::cout << "  " << threadCnts[i] << " threads: " << (long)XallocThroughput(threadCnts[i], LOOPS) << " allocs/sec" << std::endl;
+}
+
+/// Time xmalloc() on a producer thread and xfree() on a consumer thread, the
+/// pattern asynchronous delegate messages follow. Blocks are passed through a
+/// ring so the handoff itself costs little.
+static void XallocPipelineBenchmark()
+{
+	const int BLOCKS = 1000000;
+	const int RING = 4096;
+	void* ring[RING];
+	std::atomic<int> produced(0);
+	std::atomic<int> consumed(0);
+
+	auto start = std::chrono::steady_clock::now();
+	std::thread consumer([&]() {
+		for (int i = 0; i < BLOCKS; i++) {
+			while (produced.load(std::memory_order_acquire) == i)
+				std::this_thread::yield();
+			xfree(ring[i % RING]);
+			consumed.store(i + 1, std::memory_order_release);
+		}
+	});
+	for (int i = 0; i < BLOCKS; i++) {
+		while (i - consumed.load(std::memory_order_acquire) >= RING)
+			std::this_thread::yield();
+		ring[i % RING] = xmalloc(64 + i % 64);
+		produced.store(i + 1, std::memory_order_release);
+	}
+	consumer.join();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	std::cout << "xallocator producer/consumer, xmalloc on one thread and xfree on another: " 
+		<< (long)(BLOCKS / elapsed.count()) << " allocs/sec" << std::endl;
+}
+
+/// Time Allocate()/Deallocate() pairs on an allocator shared by several threads,
+/// either lock-free or serialized by a mutex.
+/// @return Allocations per second across all threads.
+static double AllocatorThroughput(Allocator& allocator, std::mutex* lock, int threadCnt, int loops)
+{
+	const int BATCH = 16;
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadCnt; t++)
+		threads.push_back(std::thread([&allocator, lock, loops]() {
+			void* blocks[BATCH];
+			for (int i = 0; i < loops; i++) {
+				for (int b = 0; b < BATCH; b++) {
+					if (lock) {
+						std::lock_guard<std::mutex> guard(*lock);
+						blocks[b] = allocator.Allocate(64);
+					}
+					else
+						blocks[b] = allocator.Allocate(64);
+				}
+				for (int b = 0; b < BATCH; b++) {
+					if (lock) {
+						std::lock_guard<std::mutex> guard(*lock);
+						allocator.Deallocate(blocks[b]);
+					}
+					else
+						allocator.Deallocate(blocks[b]);
+				}
+			}
+		}));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	return (threadCnt * loops * BATCH) / elapsed.count();
+}
+
+static void AllocatorLockFreeBenchmark()
+{
+	const int LOOPS = 50000;
+	const int threadCnts[] = { 1, 2, 4, 8 };
+	Allocator locked(64, 1024, NULL, "Locked");
+	Allocator lockFree(64, 1024, NULL, "LockFree", TRUE);
+	std::mutex lock;
+
+	std::cout << "Shared Allocator pool, " << LOOPS * 16 << " Allocate/Deallocate pairs per thread" << std::endl;
+	for (size_t i = 0; i < sizeof(threadCnts) / sizeof(threadCnts[0]); i++) {
+		std::cout << "  " << threadCnts[i] << " threads: mutex " << (long)AllocatorThroughput(locked, &lock, threadCnts[i], LOOPS)
+			<< " allocs/sec, lock-free " << (long)AllocatorThroughput(lockFree, NULL, threadCnts[i], LOOPS) << " allocs/sec" << std::endl;
+	}
+}
+#endif
+
+class MulticastBenchSubscriber
+{
+public:
+	MulticastBenchSubscriber() : sum(0) { }
+	void Add(int v) { sum += v; }
+	int sum;
+};
+
+#if USE_STD_THREADS
+static std::atomic<int> multicastSleeps(0);
+
+static void MulticastSleep(int)
+{
+	multicastSleeps++;
+	std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+#endif
+
+/// Time subscribing many synchronous delegates to one multicast delegate, and
+/// invoking it. Other allocations are interleaved with the subscriptions, as 
+/// in a running application.
+static void MulticastBenchmark()
+{
+	const int SUBSCRIBERS = 1000;
+	const int LOOPS = 2000;
+	std::vector<MulticastBenchSubscriber> subscribers(SUBSCRIBERS);
+	std::vector<std::vector<char> > clutter;
+	MulticastDelegate1<int> multicast;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < SUBSCRIBERS; i++) {
+		multicast += MakeDelegate(&subscribers[i], &MulticastBenchSubscriber::Add);
+		clutter.push_back(std::vector<char>(48 + i % 64));
+	}
+	std::chrono::duration<double, std::micro> subscribeUs = std::chrono::steady_clock::now() - start;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < LOOPS; i++)
+		multicast(1);
+	std::chrono::duration<double, std::nano> invokeNs = std::chrono::steady_clock::now() - start;
+
+	std::cout << "Multicast of " << SUBSCRIBERS << " synchronous subscribers" << std::endl;
+	std::cout << "  Subscribe all : " << (long)subscribeUs.count() << " us" << std::endl;
+	std::cout << "  Invoke        : " << invokeNs.count() / ((double)LOOPS * SUBSCRIBERS) << " ns/subscriber" << std::endl;
+}
+
+/// Time unsubscribing many delegates, in a scattered order, from a multicast 
+/// delegate with operator-=, which searches the list for an equal delegate, and 
+/// with connection handles.
+template <class TMulticast>
+static void MulticastUnsubscribeBenchmark(const char* name)
+{
+	const int SUBSCRIBERS = 1000;
+	std::vector<MulticastBenchSubscriber> subscribers(SUBSCRIBERS);
+	std::vector<DelegateConnection> connections(SUBSCRIBERS);
+	TMulticast multicast;
+
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		multicast += MakeDelegate(&subscribers[i], &MulticastBenchSubscriber::Add);
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		multicast -= MakeDelegate(&subscribers[i * 7 % SUBSCRIBERS], &MulticastBenchSubscriber::Add);
+	std::chrono::duration<double, std::micro> removeUs = std::chrono::steady_clock::now() - start;
+
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		connections[i] = multicast += MakeDelegate(&subscribers[i], &MulticastBenchSubscriber::Add);
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		connections[i * 7 % SUBSCRIBERS].Disconnect();
+	multicast(1);	// Drops the disconnected entries
+	std::chrono::duration<double, std::micro> disconnectUs = std::chrono::steady_clock::now() - start;
+
+	std::cout << name << " unsubscribe of " << SUBSCRIBERS << " subscribers" << std::endl;
+	std::cout << "  operator-=   : " << (long)removeUs.count() << " us" << std::endl;
+	std::cout << "  Disconnect() : " << (long)disconnectUs.count() << " us, including an invoke" << std::endl;
+}
+
+#if USE_STD_THREADS
+/// Time registering and unregistering a delegate on a MulticastDelegateSafe<> 
+/// while another thread publishes to a slow subscriber.
+static void MulticastSafeBenchmark()
+{
+	const int LOOPS = 200;
+	MulticastDelegateSafe1<int> multicast;
+	MulticastBenchSubscriber subscriber;
+	std::atomic<bool> stop(false);
+
+	multicast += MakeDelegate(&MulticastSleep);
+	std::thread publisher([&multicast, &stop]() {
+		while (!stop)
+			multicast(1);
+	});
+
+	// Start once the publisher is in the slow subscriber
+	while (multicastSleeps == 0)
+		std::this_thread::yield();
+
+	double totalUs = 0, worstUs = 0;
+	for (int i = 0; i < LOOPS; i++) {
+		auto start = std::chrono::steady_clock::now();
+		multicast += MakeDelegate(&subscriber, &MulticastBenchSubscriber::Add);
+		multicast -= MakeDelegate(&subscriber, &MulticastBenchSubscriber::Add);
+		std::chrono::duration<double, std::micro> elapsedUs = std::chrono::steady_clock::now() - start;
+		totalUs += elapsedUs.count();
+		worstUs = std::max(worstUs, elapsedUs.count());
+	}
+
+	stop = true;
+	publisher.join();
+
+	std::cout << "MulticastDelegateSafe subscribe/unsubscribe during a 1 ms subscriber" << std::endl;
+	std::cout << "  Subscribe + unsubscribe : " << totalUs / LOOPS << " us average, " << worstUs << " us worst" << std::endl;
+}
+
+/// A subscriber doing a fixed amount of CPU work
+class ParallelBenchSubscriber
+{
+public:
+	ParallelBenchSubscriber() : result(0) { }
+	void Work(int v) {
+		unsigned hash = v;
+		for (int i = 0; i < 20000; i++)
+			hash = hash * 31 + i;
+		result = hash;
+	}
+	unsigned result;
+};
+
+/// Time invoking a multicast delegate of CPU heavy synchronous subscribers 
+/// sequentially and in parallel on a thread pool.
+static void ParallelBenchmark()
+{
+	const int SUBSCRIBERS = 64;
+	const int LOOPS = 200;
+	std::vector<ParallelBenchSubscriber> subscribers(SUBSCRIBERS);
+	MulticastDelegate1<int> multicast;
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		multicast += MakeDelegate(&subscribers[i], &ParallelBenchSubscriber::Work);
+
+	DelegateThreadPool pool("ParallelBenchPool");
+	pool.CreateThreads();
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < LOOPS; i++)
+		multicast(i);
+	std::chrono::duration<double, std::micro> sequentialUs = std::chrono::steady_clock::now() - start;
+
+	multicast.SetParallel(&pool, pool.GetThreadCount() + 1);
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < LOOPS; i++)
+		multicast(i);
+	std::chrono::duration<double, std::micro> parallelUs = std::chrono::steady_clock::now() - start;
+	pool.ExitThreads();
+
+	std::cout << "Multicast of " << SUBSCRIBERS << " CPU heavy subscribers, " << pool.GetThreadCount() << " pool threads" << std::endl;
+	std::cout << "  Sequential : " << sequentialUs.count() / LOOPS << " us/multicast" << std::endl;
+	std::cout << "  Parallel   : " << parallelUs.count() / LOOPS << " us/multicast" << std::endl;
+}
+#endif
+
+void DelegateBenchmarks()
+{
+#if USE_STD_THREADS
+	BatchDrainBenchmark();
+	PriorityLatencyBenchmark();
+	TimerBenchmark();
+	FanOutBenchmark();
+	CoalesceBenchmark();
+	XallocBenchmark();
+	XallocPipelineBenchmark();
+	AllocatorLockFreeBenchmark();
+	MulticastSafeBenchmark();
+	ParallelBenchmark();
+#endif
+	MulticastBenchmark();
+	MulticastUnsubscribeBenchmark<MulticastDelegate1<int> >("MulticastDelegate");
+	MulticastUnsubscribeBenchmark<MulticastDelegateSafe1<int> >("MulticastDelegateSafe");
+}
+
+#endif // DELEGATE_BENCHMARKS
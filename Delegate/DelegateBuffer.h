@@ -0,0 +1,133 @@
+#ifndef _DELEGATE_BUFFER_H
+#define _DELEGATE_BUFFER_H
+
+// DelegateBuffer.h
+// @see https://github.com/endurodave/AsyncMulticastDelegate
+
+#include "DelegateAsync.h"
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#if USE_XALLOCATOR
+	#include "xallocator.h"
+#endif
+
+namespace DelegateLib {
+
+/// @brief An immutable, reference counted block of bytes for passing a large
+/// payload, such as a frame buffer or a batch of samples, to asynchronous
+/// delegates. Copying a DelegateBuffer shares the block and increments an
+/// atomic reference count; the bytes themselves are never copied. The block is
+/// freed when the last DelegateBuffer referring to it is destroyed, on whichever
+/// thread that happens to be.
+///
+/// An asynchronous delegate taking a DelegateBuffer by value, reference or
+/// pointer keeps its own DelegateBuffer inside the message it dispatches.
+/// Multicasting a buffer to N asynchronous subscribers therefore costs N
+/// reference count increments and no copies of the payload.
+class DelegateBuffer
+{
+public:
+	/// Construct an empty buffer
+	DelegateBuffer() : m_block(0) { }
+
+	/// Construct a buffer holding a copy of data.
+	/// @param[in] data - the bytes to copy.
+	/// @param[in] size - the number of bytes.
+	DelegateBuffer(const void* data, size_t size) : m_block(Allocate(size)) {
+		if (size)
+			memcpy(m_block->Data(), data, size);
+	}
+
+	/// Construct a buffer and fill it in place, avoiding a copy of the payload.
+	/// The buffer is immutable once constructed.
+	/// @param[in] size - the number of bytes.
+	/// @param[in] fill - called as fill(char* data, size_t size) to write the bytes.
+	template <class TFill>
+	DelegateBuffer(size_t size, TFill fill) : m_block(Allocate(size)) {
+		fill(m_block->Data(), size);
+	}
+
+	DelegateBuffer(const DelegateBuffer& rhs) : m_block(rhs.m_block) {
+		if (m_block)
+			m_block->refCnt.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	DelegateBuffer(DelegateBuffer&& rhs) : m_block(rhs.m_block) { rhs.m_block = 0; }
+
+	~DelegateBuffer() { Release(); }
+
+	DelegateBuffer& operator=(DelegateBuffer rhs) {
+		Block* block = m_block;
+		m_block = rhs.m_block;
+		rhs.m_block = block;
+		return *this;
+	}
+
+	/// Get the bytes. Returns 0 if the buffer is empty.
+	const char* Data() const { return m_block ? m_block->Data() : 0; }
+
+	/// Get the number of bytes
+	size_t Size() const { return m_block ? m_block->size : 0; }
+
+	bool Empty() const { return m_block == 0; }
+
+	/// Get the number of DelegateBuffer instances sharing the bytes, including
+	/// those held by messages not yet invoked.
+	int UseCount() const { return m_block ? m_block->refCnt.load(std::memory_order_relaxed) : 0; }
+
+private:
+	/// The reference count and size, followed in the same allocation by the bytes
+	struct Block
+	{
+		Block(size_t s) : refCnt(1), size(s) { }
+		char* Data() { return reinterpret_cast<char*>(this + 1); }
+
+		std::atomic<int> refCnt;
+		size_t size;
+	};
+
+	static Block* Allocate(size_t size) {
+#if USE_XALLOCATOR
+		void* mem = xmalloc(sizeof(Block) + size);
+#else
+		void* mem = ::operator new(sizeof(Block) + size);
+#endif
+		return new (mem) Block(size);
+	}
+
+	void Release() {
+		if (m_block && m_block->refCnt.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			m_block->~Block();
+#if USE_XALLOCATOR
+			xfree(m_block);
+#else
+			::operator delete(m_block);
+#endif
+		}
+		m_block = 0;
+	}
+
+	Block* m_block;
+};
+
+/// A DelegateBuffer pointer or reference argument is always copied into the
+/// message, which only increments the reference count.
+template <typename Arg>
+class DelegateArgInline<DelegateBuffer, Arg>
+{
+public:
+	enum { value = true };
+};
+
+template <typename Arg>
+class DelegateArgInline<const DelegateBuffer, Arg>
+{
+public:
+	enum { value = true };
+};
+
+}
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef _DELEGATE_CONNECTION_H
+#define _DELEGATE_CONNECTION_H
+
+// DelegateConnection.h
+// @see https://github.com/endurodave/AsyncMulticastDelegate
+
+#include "DelegateOpt.h"
+#include "Delegate.h"
+#include <atomic>
+#if USE_XALLOCATOR
+	#include "xallocator.h"
+#endif
+#if USE_DELEGATE_POOLS
+	#include "DelegatePool.h"
+#endif
+
+namespace DelegateLib {
+
+/// @brief A delegate registered with a multicast delegate container. The
+/// container and any DelegateConnection handles share the node through an
+/// atomic reference count, and the delegate is deleted with the last reference.
+/// Disconnecting only clears a flag, so it takes constant time on any thread.
+/// Containers skip disconnected nodes when invoked and drop them lazily.
+class DelegateConnectionNode
+{
+#if USE_DELEGATE_POOLS
+	DELEGATE_POOL(DelegateConnectionNode)
+#elif USE_XALLOCATOR
+	XALLOCATOR
+#endif
+public:
+	/// Constructor
+	/// @param[in] delegate - a heap allocated delegate. The node takes ownership.
+	explicit DelegateConnectionNode(DelegateBase* delegate) :
+		m_refCnt(1), m_connected(true), m_delegate(delegate) { }
+
+	/// Get the registered delegate
+	DelegateBase* GetDelegate() const { return m_delegate; }
+
+	/// Returns false once the delegate is unregistered
+	bool IsConnected() const { return m_connected.load(std::memory_order_acquire); }
+
+	/// Unregister the delegate. The node stays in its container until dropped.
+	void Disconnect() { m_connected.store(false, std::memory_order_release); }
+
+	void AddRef() { m_refCnt.fetch_add(1, std::memory_order_relaxed); }
+
+	void Release() {
+		if (m_refCnt.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			delete this;
+	}
+
+private:
+	~DelegateConnectionNode() { delete m_delegate; }
+
+	// Prevent copying objects
+	DelegateConnectionNode(const DelegateConnectionNode&);
+	DelegateConnectionNode& operator=(const DelegateConnectionNode&);
+
+	std::atomic<int> m_refCnt;
+	std::atomic<bool> m_connected;
+	DelegateBase* m_delegate;
+};
+
+/// @brief A handle to a delegate registered with a multicast delegate container,
+/// returned by the container's operator+=. Disconnect() unregisters the delegate
+/// in constant time without building an equal delegate for operator-=.
+///
+/// The handle keeps the registration alive, not the container; a handle may
+/// outlive its container and is then simply disconnected. Copies of a handle
+/// refer to the same registration. If a container is invoked on another thread
+/// while Disconnect() is called, that invocation may still call the delegate.
+class DelegateConnection
+{
+public:
+	DelegateConnection() : m_node(0) { }
+
+	explicit DelegateConnection(DelegateConnectionNode* node) : m_node(node) {
+		if (m_node)
+			m_node->AddRef();
+	}
+
+	DelegateConnection(const DelegateConnection& rhs) : m_node(rhs.m_node) {
+		if (m_node)
+			m_node->AddRef();
+	}
+
+	DelegateConnection(DelegateConnection&& rhs) : m_node(rhs.m_node) { rhs.m_node = 0; }
+
+	~DelegateConnection() {
+		if (m_node)
+			m_node->Release();
+	}
+
+	DelegateConnection& operator=(DelegateConnection rhs) {
+		DelegateConnectionNode* node = m_node;
+		m_node = rhs.m_node;
+		rhs.m_node = node;
+		return *this;
+	}
+
+	/// Returns true while the delegate is registered
+	bool IsConnected() const { return m_node && m_node->IsConnected(); }
+
+	/// Unregister the delegate. Does nothing if already unregistered.
+	void Disconnect() {
+		if (m_node)
+			m_node->Disconnect();
+	}
+
+	/// Get the registration, or 0 for a default constructed handle
+	DelegateConnectionNode* GetNode() const { return m_node; }
+
+private:
+	DelegateConnectionNode* m_node;
+};
+
+/// @brief Unregisters a delegate when it goes out of scope. Typically a member
+/// of the subscriber, so the subscription ends with the subscriber.
+/// @code
+/// m_connection = SysData::GetInstance().SystemModeChangedDelegate +=
+///		MakeDelegate(this, &SysDataClient::CallbackFunction, &workerThread1);
+/// @endcode
+class ScopedDelegateConnection
+{
+public:
+	ScopedDelegateConnection() { }
+
+	ScopedDelegateConnection(const DelegateConnection& connection) : m_connection(connection) { }
+
+	ScopedDelegateConnection(ScopedDelegateConnection&& rhs) : m_connection(std::move(rhs.m_connection)) { }
+
+	~ScopedDelegateConnection() { m_connection.Disconnect(); }
+
+	/// Unregister the current delegate, if any, and take ownership of another
+	ScopedDelegateConnection& operator=(const DelegateConnection& connection) {
+		m_connection.Disconnect();
+		m_connection = connection;
+		return *this;
+	}
+
+	ScopedDelegateConnection& operator=(ScopedDelegateConnection&& rhs) {
+		if (this != &rhs) {
+			m_connection.Disconnect();
+			m_connection = std::move(rhs.m_connection);
+		}
+		return *this;
+	}
+
+	/// Returns true while the delegate is registered
+	bool IsConnected() const { return m_connection.IsConnected(); }
+
+	/// Unregister the delegate now
+	void Disconnect() { m_connection.Disconnect(); }
+
+	/// Give up ownership without unregistering the delegate
+	/// @return The connection handle.
+	DelegateConnection Release() {
+		DelegateConnection connection = m_connection;
+		m_connection = DelegateConnection();
+		return connection;
+	}
+
+private:
+	// Prevent copying objects
+	ScopedDelegateConnection(const ScopedDelegateConnection&);
+	ScopedDelegateConnection& operator=(const ScopedDelegateConnection&);
+
+	DelegateConnection m_connection;
+};
+
+}
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef _DELEGATE_INVOKER_H
 #define _DELEGATE_INVOKER_H
 
+#include "DelegatePriority.h"
+#include <atomic>
+
 namespace DelegateLib {
 
 class DelegateMsgBase;
@@ -13,6 +16,54 @@ public:
 	virtual void DelegateInvoke(DelegateMsgBase** msg) = 0;
 };
 
+/// @brief Dispatch settings common to all asynchronous delegates. 
+class DelegateAsyncBase
+{
+public:
+	DelegateAsyncBase() : m_priority(PRIORITY_NORMAL), m_dispatched(true) { }
+	DelegateAsyncBase(const DelegateAsyncBase& rhs) : 
+		m_priority(rhs.m_priority), m_dispatched(rhs.IsDispatched()) { }
+	DelegateAsyncBase& operator=(const DelegateAsyncBase& rhs) {
+		m_priority = rhs.m_priority;
+		SetDispatched(rhs.IsDispatched());
+		return *this;
+	}
+
+	/// Set the default priority of messages dispatched by this delegate. Copies 
+	/// of the delegate, such as those held by a multicast delegate, keep it.
+	void SetPriority(DelegatePriority priority) { m_priority = priority; }
+
+	/// Get the default priority of messages dispatched by this delegate.
+	DelegatePriority GetPriority() const { return m_priority; }
+
+	/// Returns false if the target thread rejected the last asynchronous invocation 
+	/// of this delegate, for example because its queue was full. Callers can use 
+	/// this to shed load. 
+	bool IsDispatched() const { return m_dispatched.load(std::memory_order_relaxed); }
+
+protected:
+	/// Record the result of the last DelegateThread::DispatchDelegate() call
+	void SetDispatched(bool dispatched) { m_dispatched.store(dispatched, std::memory_order_relaxed); }
+
+	/// Get the priority for the next dispatch. 
+	/// @return The calling thread's DelegatePriorityScope override if one is 
+	///		active, otherwise this delegate's default priority. 
+	DelegatePriority GetDispatchPriority() const
+	{
+		DelegatePriority priority = DelegatePriorityScope::GetOverride();
+		if (priority != PRIORITY_LEVELS)
+			return priority;
+		return m_priority;
+	}
+
+private:
+	DelegatePriority m_priority;
+
+	/// Atomic since MulticastDelegateSafe<> publishers may invoke the same 
+	/// delegate instance on several threads at once
+	std::atomic<bool> m_dispatched;
+};
+
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -3,6 +3,10 @@
 
 #include "Fault.h"
 #include "DelegateInvoker.h"
+#include "MpscQueue.h"
+#include <cstddef>
+#include <tuple>
+#include <utility>
 #if USE_XALLOCATOR
 	#include "xallocator.h"
 #endif
@@ -11,7 +15,10 @@ namespace DelegateLib {
 
 class DelegateBase;
 
+/// @brief Base class for all delegate messages. The message is itself the queue 
+/// node, so a DelegateThread can queue it without allocating. 
 class DelegateMsgBase
+	: public QueueNode
 {
 #if USE_XALLOCATOR
 	XALLOCATOR
@@ -21,7 +28,9 @@ public:
 	/// @param[in] invoker - the invoker instance the delegate is registered with.
 	/// @param[in] delegate - the delegate instance. 
 	DelegateMsgBase(IDelegateInvoker* invoker) :
-		m_invoker(invoker)
+		m_invoker(invoker),
+		m_priority(PRIORITY_NORMAL),
+		m_discarded(false)
 	{
 		ASSERT_TRUE(m_invoker != 0);
 	}
@@ -29,152 +38,98 @@ public:
 	/// Get the delegate invoker instance the delegate is registered with.
 	/// @return The invoker instance. 
 	IDelegateInvoker* GetDelegateInvoker() const { return m_invoker; }
+
+	/// Get the priority the target thread should run this message at.
+	DelegatePriority GetPriority() const { return m_priority; }
+
+	/// Set the priority the target thread should run this message at.
+	void SetPriority(DelegatePriority priority) { m_priority = priority; }
+
+	/// Returns true if the message was discarded by the target thread. 
+	/// DelegateInvoke() frees a discarded message without invoking the target 
+	/// function.
+	bool IsDiscarded() const { return m_discarded; }
+
+	/// Mark the message as discarded, or not, before calling DelegateInvoke(). 
+	void SetDiscarded(bool discarded) { m_discarded = discarded; }
 	
 private:
 	/// The IDelegateInvoker instance 
 	IDelegateInvoker* m_invoker;
-};
 
-/// @brief A class containing the delegate information passed through 
-/// the message queue. 
-template <typename Param1>
-class DelegateMsg1 : public DelegateMsgBase
-{
-public:
-	/// Constructor
-	/// @param[in] invoker - the invoker instance the delegate is registered with.
-	/// @param[in] param1 - the data sent as delegate function argument.
-	DelegateMsg1(IDelegateInvoker* invoker, Param1 param1) :
-		DelegateMsgBase(invoker),
-		m_param1(param1)
-	{
-	}
-
-	/// Get the delegate data passed into the delegate function. 
-	/// @return The param1 delegate function data. 
-	Param1 GetParam1() const { return m_param1;	}
+	/// The dispatch priority
+	DelegatePriority m_priority;
 
-private:
-	/// The data argument passed into the callback function
-	Param1 m_param1;
+	/// Set if the message is to be freed without being invoked
+	bool m_discarded;
 };
 
-template <typename Param1, typename Param2>
-class DelegateMsg2 : public DelegateMsgBase
+/// @brief Holds a delegate function argument in a message exactly as passed, 
+/// without a copy. Used where the caller waits for the message to be invoked. 
+/// A pass by value argument is moved in and moved out to the target function.
+template <typename Param>
+class DelegateMsgArg
 {
 public:
-	/// Constructor
-	/// @param[in] invoker - the invoker instance the delegate is registered with.
-	/// @param[in] param1 - the data sent as delegate function argument.
-	DelegateMsg2(IDelegateInvoker* invoker, Param1 param1, Param2 param2) :
-		DelegateMsgBase(invoker),
-		m_param1(param1),
-		m_param2(param2)
-	{
-	}
+	DelegateMsgArg(Param param) : m_param(std::forward<Param>(param)) { }
 
-	/// Get the delegate data passed into the delegate function. 
-	/// @return The param1 delegate function data. 
-	Param1 GetParam1() const { return m_param1;	}
-	Param2 GetParam2() const { return m_param2;	}
+	/// Get the argument. Called once, when the message is invoked. 
+	Param Get() { return std::forward<Param>(m_param); }
 
 private:
-	/// The data argument passed into the invoked function
-	Param1 m_param1;
-	Param2 m_param2;
+	Param m_param;
 };
 
-template <typename Param1, typename Param2, typename Param3>
-class DelegateMsg3 : public DelegateMsgBase
+/// @brief A compile time list of indices. Used to expand the arguments held in 
+/// a DelegateMsg<> into a function call. 
+template <size_t... Indices>
+struct DelegateIndices
 {
-public:
-	/// Constructor
-	/// @param[in] invoker - the invoker instance the delegate is registered with.
-	/// @param[in] param1 - the data sent as delegate function argument.
-	DelegateMsg3(IDelegateInvoker* invoker, Param1 param1, Param2 param2, Param3 param3) :
-		DelegateMsgBase(invoker),
-		m_param1(param1),
-		m_param2(param2),
-		m_param3(param3)
-	{
-	}
-
-	/// Get the delegate data passed into the delegate function. 
-	/// @return The param1 delegate function data. 
-	Param1 GetParam1() const { return m_param1;	}
-	Param2 GetParam2() const { return m_param2;	}
-	Param3 GetParam3() const { return m_param3;	}
-
-private:
-	/// The data argument passed into the invoked function
-	Param1 m_param1;
-	Param2 m_param2;
-	Param3 m_param3;
 };
 
-template <typename Param1, typename Param2, typename Param3, typename Param4>
-class DelegateMsg4 : public DelegateMsgBase
+/// @brief Builds DelegateIndices<0, 1, ... N-1> as the Type member.
+template <size_t N, size_t... Indices>
+struct DelegateMakeIndices : DelegateMakeIndices<N - 1, N - 1, Indices...>
 {
-public:
-	/// Constructor
-	/// @param[in] invoker - the invoker instance the delegate is registered with.
-	/// @param[in] param1 - the data sent as delegate function argument.
-	DelegateMsg4(IDelegateInvoker* invoker, Param1 param1, Param2 param2, Param3 param3, Param4 param4) :
-		DelegateMsgBase(invoker),
-		m_param1(param1),
-		m_param2(param2),
-		m_param3(param3),
-		m_param4(param4)
-	{
-	}
-
-	/// Get the delegate data passed into the delegate function. 
-	/// @return The param1 delegate function data. 
-	Param1 GetParam1() const { return m_param1;	}
-	Param2 GetParam2() const { return m_param2;	}
-	Param3 GetParam3() const { return m_param3;	}
-	Param4 GetParam4() const { return m_param4;	}
+};
 
-private:
-	/// The data argument passed into the invoked function
-	Param1 m_param1;
-	Param2 m_param2;
-	Param3 m_param3;
-	Param4 m_param4;
+template <size_t... Indices>
+struct DelegateMakeIndices<0, Indices...>
+{
+	typedef DelegateIndices<Indices...> Type;
 };
 
-template <typename Param1, typename Param2, typename Param3, typename Param4, typename Param5>
-class DelegateMsg5 : public DelegateMsgBase
+/// @brief A class containing the delegate information passed through 
+/// the message queue. The Arg template holds each argument; DelegateMsgArg 
+/// passes arguments through as is, DelegateArg holds a copy owned by the message.
+template <template <typename> class Arg, typename... Args>
+class DelegateMsg : public DelegateMsgBase
 {
 public:
 	/// Constructor
 	/// @param[in] invoker - the invoker instance the delegate is registered with.
-	/// @param[in] param1 - the data sent as delegate function argument.
-	DelegateMsg5(IDelegateInvoker* invoker, Param1 param1, Param2 param2, Param3 param3, Param4 param4, Param5 param5) :
+	/// @param[in] args - the data sent as delegate function arguments.
+	DelegateMsg(IDelegateInvoker* invoker, Args... args) :
 		DelegateMsgBase(invoker),
-		m_param1(param1),
-		m_param2(param2),
-		m_param3(param3),
-		m_param4(param4),
-		m_param5(param5)
+		m_args(std::forward<Args>(args)...)
 	{
 	}
 
-	/// Get the delegate data passed into the delegate function. 
-	/// @return The param1 delegate function data. 
-	Param1 GetParam1() const { return m_param1;	}
-	Param2 GetParam2() const { return m_param2;	}
-	Param3 GetParam3() const { return m_param3;	}
-	Param4 GetParam4() const { return m_param4;	}
-	Param5 GetParam5() const { return m_param5;	}
+	/// Invoke a function with the delegate data passed into the delegate function. 
+	/// Pass by value arguments are moved out, so call at most once. 
+	/// @param[in] func - the function or delegate to invoke.
+	/// @return The value func returns.
+	template <typename RetType, typename TFunc>
+	RetType Call(TFunc& func) {
+		return Call<RetType>(func, typename DelegateMakeIndices<sizeof...(Args)>::Type()); }
 
 private:
-	/// The data argument passed into the invoked function
-	Param1 m_param1;
-	Param2 m_param2;
-	Param3 m_param3;
-	Param4 m_param4;
-	Param5 m_param5;
+	template <typename RetType, typename TFunc, size_t... Indices>
+	RetType Call(TFunc& func, DelegateIndices<Indices...>) {
+		return func(std::get<Indices>(m_args).Get()...); }
+
+	/// The data arguments passed into the invoked function
+	std::tuple<Arg<Args>...> m_args;
 };
 
 }
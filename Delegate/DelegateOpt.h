@@ -4,22 +4,24 @@
 // Define either USE_WIN32_THREADS or USE_STD_THREADS to specify WIN32 or std::thread threading model.
 // Define USE_CPLUSPLUS_11 if the compiler supports C++ 11 features.
 // Define USE_XALLOCATOR to use fixed block memory allocation.
+// Define USE_DELEGATE_POOLS to use a fixed block pool per delegate and message type.
 
-// Define USE_CPLUSPLUS_11 if using a C++11 compliant compiler. Using Visual Studio, if the _MSC_VER 
-// is >= 1700 then C++11 features are available. 
-#if _MSC_VER >= 1700
+// Define USE_CPLUSPLUS_11 if using a C++11 compliant compiler. The delegates are variadic 
+// templates, so a C++11 compiler is required. Using Visual Studio, if the _MSC_VER 
+// is >= 1800 then the C++11 features used are available. 
+#if _MSC_VER >= 1800
 	#define USE_CPLUSPLUS_11 1
 	#define USE_STD_THREADS	1
 	//#define USE_WIN32_THREADS 1 
-#elif _MSC_VER >= 1500
-	#define USE_WIN32_THREADS 1
 #endif
 
 #if __GNUC__ >= 5
 	#define USE_CPLUSPLUS_11 1
 	#define USE_STD_THREADS	1
-#elif __GNUC__ == 4 
-	#define USE_STD_THREADS	1
+#endif
+
+#if !defined(USE_CPLUSPLUS_11)
+	#error C++11 compiler required. Delegates use variadic and alias templates.
 #endif
 
 #if defined(USE_STD_THREADS) && defined(USE_WIN32_THREADS)
@@ -34,8 +36,11 @@
 	#error GCC does not support WIN32 API. Define USE_STD_THREADS.
 #endif
 
-#if defined(USE_STD_THREADS) && !defined(USE_CPLUSPLUS_11)
-	#error C++11 compiler required to use std::thread API
+// An asynchronous delegate copies a pointer or reference argument into the message it 
+// dispatches when the argument type is no larger than this, in bytes. Larger types are 
+// copied onto the heap using DelegateParam<>. Define as 0 to always use the heap.
+#ifndef DELEGATE_INLINE_ARG_SIZE
+	#define DELEGATE_INLINE_ARG_SIZE 32
 #endif
 
 // To make the delegate library use a fixed block memory allocator uncomment the include
@@ -44,4 +49,22 @@
 // @see https://github.com/endurodave/xallocator
 //#define USE_XALLOCATOR 1
 
+// Define USE_DELEGATE_POOLS to give each asynchronous delegate type and each message 
+// type its own fixed block pool of DELEGATE_POOL_BLOCKS objects, sized by sizeof at 
+// compile time. Allocation from a pool is lock-free. Objects beyond a pool's capacity 
+// come from the heap. Call DelegatePoolBase::Stats() for each type's high-water mark.
+//#define USE_DELEGATE_POOLS 1
+#ifndef DELEGATE_POOL_BLOCKS
+	#define DELEGATE_POOL_BLOCKS 64
+#endif
+
+// Define DELEGATE_ALLOC_COUNT_TESTS in a DELEGATE_UNIT_TESTS build to replace the global 
+// operator new and delete with versions counting the heap allocations made by a test, 
+// and check that asynchronous calls allocate no more than expected. 
+//#define DELEGATE_ALLOC_COUNT_TESTS 1
+
+// Define DELEGATE_BENCHMARKS to run the throughput and latency benchmarks from main(). 
+// Results are printed to stdout. Build optimized for meaningful numbers.
+//#define DELEGATE_BENCHMARKS 1
+
 #endif
@@ -0,0 +1,89 @@
+#include "DelegatePool.h"
+#include <iostream>
+#include <new>
+#if USE_XALLOCATOR
+	#include "xallocator.h"
+#endif
+
+namespace DelegateLib {
+
+std::atomic<DelegatePoolBase*> DelegatePoolBase::m_first(0);
+
+/// Round a block size up so every block in the pool is suitably aligned
+static size_t AlignBlockSize(size_t size)
+{
+	const size_t align = alignof(std::max_align_t);
+	return (size + align - 1) & ~(align - 1);
+}
+
+//----------------------------------------------------------------------------
+// DelegatePoolBase
+//----------------------------------------------------------------------------
+DelegatePoolBase::DelegatePoolBase(size_t size, UINT blocks, const char* name) :
+	m_allocator(AlignBlockSize(size), blocks, NULL, name, TRUE),
+	m_blockCnt(blocks),
+	m_overflows(0),
+	m_name(name),
+	m_next(0)
+{
+	// Add to the list of pools
+	DelegatePoolBase* first = m_first.load(std::memory_order_relaxed);
+	do
+	{
+		m_next = first;
+	} while (!m_first.compare_exchange_weak(first, this, 
+		std::memory_order_release, std::memory_order_relaxed));
+}
+
+//----------------------------------------------------------------------------
+// Allocate
+//----------------------------------------------------------------------------
+void* DelegatePoolBase::Allocate(size_t size)
+{
+	void* pObject = 0;
+	if (size <= m_allocator.GetBlockSize())
+		pObject = m_allocator.TryAllocate(size);
+	if (pObject)
+		return pObject;
+
+	m_overflows.fetch_add(1, std::memory_order_relaxed);
+#if USE_XALLOCATOR
+	return xmalloc(size);
+#else
+	return ::operator new(size);
+#endif
+}
+
+//----------------------------------------------------------------------------
+// Deallocate
+//----------------------------------------------------------------------------
+void DelegatePoolBase::Deallocate(void* pObject)
+{
+	if (m_allocator.Contains(pObject))
+		m_allocator.Deallocate(pObject);
+	else
+#if USE_XALLOCATOR
+		xfree(pObject);
+#else
+		::operator delete(pObject);
+#endif
+}
+
+//----------------------------------------------------------------------------
+// Stats
+//----------------------------------------------------------------------------
+void DelegatePoolBase::Stats()
+{
+	for (DelegatePoolBase* pool = GetFirst(); pool; pool = pool->GetNext())
+	{
+		std::cout << pool->GetName();
+		std::cout << " Block Size: " << pool->GetBlockSize();
+		std::cout << " Blocks: " << pool->GetBlockCount();
+		std::cout << " In Use: " << pool->GetBlocksInUse();
+		std::cout << " High-Water: " << pool->GetMaxBlocksInUse();
+		std::cout << " Overflows: " << pool->GetOverflows();
+		std::cout << std::endl;
+	}
+}
+
+}
@@ -0,0 +1,112 @@
+#ifndef _DELEGATE_POOL_H
+#define _DELEGATE_POOL_H
+
+// DelegatePool.h
+// @see https://github.com/endurodave/AsyncMulticastDelegate
+
+#include "DelegateOpt.h"
+#include "Allocator.h"
+#include "DataTypes.h"
+#include <atomic>
+#include <cstddef>
+#include <typeinfo>
+
+namespace DelegateLib {
+
+/// @brief A fixed block pool of DELEGATE_POOL_BLOCKS blocks for objects of a 
+/// single type. Allocation and deallocation are lock-free, so an object may be
+/// created on one thread and deleted on another, as asynchronous delegate 
+/// messages are. Once the pool is exhausted objects come from the heap, or from
+/// the xallocator if USE_XALLOCATOR is defined, and are counted as overflows.
+///
+/// Every pool is kept on a list for reporting, see Stats(). 
+class DelegatePoolBase
+{
+public:
+	/// Get memory for an object. 
+	/// @param[in] size - the object size. Objects larger than the pool's block 
+	///		size, such as a derived type without its own pool, come from the heap.
+	void* Allocate(size_t size);
+
+	/// Free memory obtained from Allocate()
+	void Deallocate(void* pObject);
+
+	/// Get the type name
+	const char* GetName() const { return m_name; }
+
+	/// Get the size of each block, in bytes
+	size_t GetBlockSize() { return m_allocator.GetBlockSize(); }
+
+	/// Get the number of blocks in the pool
+	UINT GetBlockCount() const { return m_blockCnt; }
+
+	/// Get the number of pool blocks in use
+	UINT GetBlocksInUse() { return m_allocator.GetBlocksInUse(); }
+
+	/// Get the largest number of pool blocks in use at once. A high-water mark 
+	/// equal to GetBlockCount() means the pool was exhausted at some point.
+	UINT GetMaxBlocksInUse() { return m_allocator.GetMaxBlocksInUse(); }
+
+	/// Get the number of objects that did not fit in the pool
+	UINT GetOverflows() const { return m_overflows.load(std::memory_order_relaxed); }
+
+	/// Get the first pool created. Pools are never destroyed.
+	static DelegatePoolBase* GetFirst() { return m_first.load(std::memory_order_acquire); }
+
+	/// Get the next pool on the list, or 0 if none
+	DelegatePoolBase* GetNext() const { return m_next; }
+
+	/// Output every pool's statistics to the standard output
+	static void Stats();
+
+protected:
+	/// Constructor
+	/// @param[in] size - the object size.
+	/// @param[in] blocks - the number of objects the pool holds.
+	/// @param[in] name - the type name.
+	DelegatePoolBase(size_t size, UINT blocks, const char* name);
+
+private:
+	// Prevent copying objects
+	DelegatePoolBase(const DelegatePoolBase&);
+	DelegatePoolBase& operator=(const DelegatePoolBase&);
+
+	Allocator m_allocator;
+	const UINT m_blockCnt;
+	std::atomic<UINT> m_overflows;
+	const char* m_name;
+	DelegatePoolBase* m_next;
+
+	static std::atomic<DelegatePoolBase*> m_first;
+};
+
+/// @brief The pool for objects of type T, sized by sizeof(T). 
+template <class T>
+class DelegatePool : public DelegatePoolBase
+{
+public:
+	/// Get the pool. Created on first use and never destroyed, so objects 
+	/// deleted during static destruction still find their pool. 
+	static DelegatePool& Instance() 
+	{
+		static DelegatePool* pool = new DelegatePool();
+		return *pool;
+	}
+
+private:
+	DelegatePool() : DelegatePoolBase(sizeof(T), DELEGATE_POOL_BLOCKS, typeid(T).name()) { }
+};
+
+}
+
+// Macro to overload new/delete for a class with its own DelegatePool
+#define DELEGATE_POOL(Class) \
+	public: \
+		static void* operator new(size_t size) { \
+			return DelegateLib::DelegatePool<Class>::Instance().Allocate(size); \
+		} \
+		static void operator delete(void* pObject) { \
+			DelegateLib::DelegatePool<Class>::Instance().Deallocate(pObject); \
+		}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef _DELEGATE_PRIORITY_H
+#define _DELEGATE_PRIORITY_H
+
+#include "DelegateOpt.h"
+
+namespace DelegateLib {
+
+/// Dispatch priority of an asynchronous delegate message. A DelegateThread 
+/// that supports priorities runs queued higher priority messages first.
+enum DelegatePriority
+{
+	PRIORITY_LOW,
+	PRIORITY_NORMAL,
+	PRIORITY_HIGH,
+	PRIORITY_LEVELS		///< Number of priority levels. Not a valid priority.
+};
+
+/// @brief Overrides the priority of every asynchronous delegate invoked by the 
+/// calling thread while the scope object exists. Scopes may be nested. 
+/// 
+/// Use to raise or lower a single call without changing the delegate's default:
+/// 
+///     {
+///         DelegatePriorityScope scope(PRIORITY_HIGH);
+///         controlLoopDelegate(value);
+///     }
+class DelegatePriorityScope
+{
+public:
+	DelegatePriorityScope(DelegatePriority priority) : m_prev(Current()) { Current() = priority; }
+	~DelegatePriorityScope() { Current() = m_prev; }
+
+	/// Get the calling thread's active override. 
+	/// @return The override priority, or PRIORITY_LEVELS if no scope is active. 
+	static DelegatePriority GetOverride() { return Current(); }
+
+private:
+	// Prevent copying objects
+	DelegatePriorityScope(const DelegatePriorityScope&);
+	DelegatePriorityScope& operator=(const DelegatePriorityScope&);
+
+	static DelegatePriority& Current() 
+	{
+		static thread_local DelegatePriority priority = PRIORITY_LEVELS;
+		return priority;
+	}
+
+	DelegatePriority m_prev;
+};
+
+}
+
+#endif
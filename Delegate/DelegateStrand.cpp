@@ -0,0 +1,146 @@
+#include "DelegateStrand.h"
+
+namespace DelegateLib {
+
+/// The strand whose run message the calling thread is dispatching, if any
+static thread_local DelegateStrand* schedulingStrand = 0;
+
+//----------------------------------------------------------------------------
+// DelegateStrand
+//----------------------------------------------------------------------------
+DelegateStrand::DelegateStrand(DelegateThread* executor, UINT maxPerRun) :
+	m_executor(executor),
+	m_maxPerRun(maxPerRun ? maxPerRun : 1),
+	m_scheduled(false),
+	m_runRejected(false),
+	m_runMsg(this)
+{
+	ASSERT_TRUE(m_executor != 0);
+	LockGuard::Create(&m_lock);
+}
+
+//----------------------------------------------------------------------------
+// ~DelegateStrand
+//----------------------------------------------------------------------------
+DelegateStrand::~DelegateStrand()
+{
+	ASSERT_TRUE(!m_scheduled);
+	LockGuard::Destroy(&m_lock);
+}
+
+//----------------------------------------------------------------------------
+// IsBusy
+//----------------------------------------------------------------------------
+bool DelegateStrand::IsBusy()
+{
+	LockGuard lockGuard(&m_lock);
+	return m_scheduled;
+}
+
+//----------------------------------------------------------------------------
+// DispatchDelegate
+//----------------------------------------------------------------------------
+bool DelegateStrand::DispatchDelegate(DelegateMsgBase* msg)
+{
+	bool schedule;
+	{
+		LockGuard lockGuard(&m_lock);
+		m_queue.Push(msg);
+		schedule = !m_scheduled;
+		m_scheduled = true;
+	}
+
+	if (!schedule)
+		return true;
+
+	// First message on an idle strand schedules the strand on the executor. A
+	// rejection on this thread is handled here rather than by DelegateInvoke().
+	DelegateStrand* prev = schedulingStrand;
+	schedulingStrand = this;
+	m_runRejected = false;
+	m_executor->DispatchDelegate(&m_runMsg);
+	schedulingStrand = prev;
+	if (!m_runRejected)
+		return true;
+
+	// Only msg, at the head of the queue, is rejected. Messages queued behind 
+	// it meanwhile were accepted, so schedule the strand again for them.
+	bool reschedule;
+	{
+		LockGuard lockGuard(&m_lock);
+		QueueNode* head = m_queue.Pop();
+		ASSERT_TRUE(head == msg);
+		reschedule = !m_queue.Empty();
+		m_scheduled = reschedule;
+	}
+	DiscardMsg(msg);
+
+	// Should the executor reject the strand again, DelegateInvoke() discards the queue
+	if (reschedule)
+		m_executor->DispatchDelegate(&m_runMsg);
+	return false;
+}
+
+//----------------------------------------------------------------------------
+// DiscardQueue
+//----------------------------------------------------------------------------
+void DelegateStrand::DiscardQueue()
+{
+	IntrusiveQueue discarded;
+	{
+		LockGuard lockGuard(&m_lock);
+		discarded.Splice(m_queue, 0);
+		m_scheduled = false;
+	}
+
+	QueueNode* node;
+	while ((node = discarded.Pop()) != 0)
+		DiscardMsg(static_cast<DelegateMsgBase*>(node));
+}
+
+//----------------------------------------------------------------------------
+// DelegateInvoke
+//----------------------------------------------------------------------------
+void DelegateStrand::DelegateInvoke(DelegateMsgBase** msg)
+{
+	ASSERT_TRUE(*msg == &m_runMsg);
+
+	if (m_runMsg.IsDiscarded())
+	{
+		m_runMsg.SetDiscarded(false);
+		if (schedulingStrand == this)
+		{
+			// Rejected while DispatchDelegate() schedules the strand on this thread
+			m_runRejected = true;
+			return;
+		}
+
+		// The executor dropped the strand. Its messages can no longer run in order.
+		DiscardQueue();
+		return;
+	}
+
+	for (UINT i = 0; i < m_maxPerRun; i++)
+	{
+		QueueNode* node;
+		{
+			LockGuard lockGuard(&m_lock);
+			node = m_queue.Pop();
+			if (!node)
+			{
+				// Strand is idle. The next dispatch schedules it again.
+				m_scheduled = false;
+				return;
+			}
+		}
+
+		// Invoke the callback on the executor thread
+		DelegateMsgBase* delegateMsg = static_cast<DelegateMsgBase*>(node);
+		delegateMsg->GetDelegateInvoker()->DelegateInvoke(&delegateMsg);
+	}
+
+	// Still busy. Go to the back of the executor's queue so other work can run.
+	m_executor->DispatchDelegate(&m_runMsg);
+}
+
+}
@@ -0,0 +1,86 @@
+#ifndef _DELEGATE_STRAND_H
+#define _DELEGATE_STRAND_H
+
+#include "DelegateOpt.h"
+
+#include "DelegateThread.h"
+#include "DelegateInvoker.h"
+#include "MpscQueue.h"
+#include "LockGuard.h"
+#include "DataTypes.h"
+
+namespace DelegateLib {
+
+/// @brief A DelegateThread that runs its delegates one at a time, in FIFO 
+/// order, on another DelegateThread called the executor. 
+///
+/// A strand gives the same ordered, non-overlapping execution as a dedicated 
+/// WorkerThread without an OS thread of its own. Many strands can share one 
+/// executor, typically a DelegateThreadPool. While a strand has work it keeps 
+/// a single run message queued on the executor, so the strand's delegates can 
+/// never run on two executor threads at once. The run message is embedded in 
+/// the strand; scheduling a strand does not allocate.
+class DelegateStrand : public DelegateThread, public IDelegateInvoker
+{
+public:
+	/// Constructor
+	/// @param[in] executor - the thread or pool that runs this strand's delegates.
+	/// @param[in] maxPerRun - the maximum delegates run each time the strand is 
+	///		scheduled before yielding the executor thread to other work. 
+	DelegateStrand(DelegateThread* executor, UINT maxPerRun = 16);
+
+	/// Destructor
+	/// @pre The strand must be idle. Exit the executor or wait for pending
+	///		delegates to complete before destroying a strand. 
+	~DelegateStrand();
+
+	/// Get the executor this strand runs on
+	DelegateThread* GetExecutor() const { return m_executor; }
+
+	/// Returns true if the strand has delegates waiting to run or running
+	bool IsBusy();
+
+	/// Queue a delegate message on this strand. Messages run in dispatch order; 
+	/// message priority is ignored. 
+	/// @return false if msg scheduled an idle strand and the executor rejected 
+	///		it. Only msg is discarded; messages queued meanwhile are scheduled 
+	///		again. If the executor rejects that too, or later drops the strand, 
+	///		every message queued on the strand is discarded, releasing any 
+	///		waiting callers.
+	virtual bool DispatchDelegate(DelegateMsgBase* msg);
+
+	/// Called by the executor thread to run the strand's queued delegates
+	virtual void DelegateInvoke(DelegateMsgBase** msg);
+
+private:
+	// Prevent copying objects
+	DelegateStrand(const DelegateStrand&);
+	DelegateStrand& operator=(const DelegateStrand&);
+
+	/// Discard every queued message and mark the strand idle. Called when the
+	/// executor discards m_runMsg.
+	void DiscardQueue();
+
+	DelegateThread* const m_executor;
+	const UINT m_maxPerRun;
+
+	/// Lock protecting m_queue and m_scheduled
+	LOCK m_lock;
+
+	/// Delegate messages waiting to run on this strand
+	IntrusiveQueue m_queue;
+
+	/// True while m_runMsg is queued on, or running on, the executor
+	bool m_scheduled;
+
+	/// Set when the executor rejects m_runMsg within DispatchDelegate(). 
+	/// Only used by the thread scheduling the strand.
+	bool m_runRejected;
+
+	/// Dispatched to the executor to run the strand. Never deleted. 
+	DelegateMsgBase m_runMsg;
+};
+
+}
+
+#endif
@@ -19,9 +19,24 @@ public:
 	/// must be called to execute the callback. 
 	/// @param[in] msg - a pointer to the callback message that must be created dynamically
 	///		using operator new. 
+	/// Implementations that support priorities should run messages with a higher 
+	/// DelegateMsgBase::GetPriority() first; others may ignore it.
+	/// @return true if the message was accepted. false if the thread rejected
+	///		it, for instance because its queue is full. A rejected message has 
+	///		already been freed by DiscardMsg(); the caller must not touch it. 
 	/// @pre Caller *must* create the DelegateMsg argument dynamically using operator new.
 	/// @post The destination thread must delete the msg instance by calling DelegateInvoke().
-	virtual void DispatchDelegate(DelegateMsgBase* msg) = 0;
+	virtual bool DispatchDelegate(DelegateMsgBase* msg) = 0;
+
+protected:
+	/// Free a message without invoking the target function. Used by implementations
+	/// to reject or drop a message. Any thread waiting on the message is released.
+	/// @param[in] msg - the message to discard.
+	static void DiscardMsg(DelegateMsgBase* msg)
+	{
+		msg->SetDiscarded(true);
+		msg->GetDelegateInvoker()->DelegateInvoke(&msg);
+	}
 };
 
 }
@@ -1,9 +1,22 @@
 #ifdef DELEGATE_UNIT_TESTS
 
 #include "DelegateLib.h"
+#include "xallocator.h"
+#include "Allocator.h"
+#include "DelegatePool.h"
 #include <iostream>
+#include <sstream>
+#include <type_traits>
+#include <cstring>
 #if USE_STD_THREADS
 	#include "WorkerThreadStd.h"
+	#include "DelegateThreadPool.h"
+	#include "Timer.h"
+	#include <thread>
+	#include <chrono>
+	#include <set>
+	#include <vector>
+	#include <algorithm>
 #elif USE_WIN32_THREADS
 	#include "WorkerThreadWin.h"
 #endif
@@ -12,6 +25,39 @@ using namespace DelegateLib;
 
 WorkerThread testThread("DelegateUnitTestsThread");
 
+#if DELEGATE_ALLOC_COUNT_TESTS
+#include <cstdlib>
+#include <new>
+
+// Count global heap allocations made by the calling thread between 
+// StartAllocCount() and StopAllocCount(). Classes using XALLOCATOR bypass 
+// the global operator new and are not counted. 
+static thread_local bool allocCountEnabled = false;
+static thread_local int allocCount = 0;
+
+void* operator new(size_t size)
+{
+	if (allocCountEnabled)
+		allocCount++;
+	void* p = malloc(size ? size : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void* p) noexcept
+{
+	free(p);
+}
+
+static void StartAllocCount() { allocCount = 0; allocCountEnabled = true; }
+static int StopAllocCount() { allocCountEnabled = false; return allocCount; }
+#else
+// The global operator new is not replaced. Allocation counts are not checked.
+static void StartAllocCount() { }
+static int StopAllocCount() { return 0; }
+#endif
+
 static const INT TEST_INT = 12345678;
 
 struct StructParam { INT val; };
@@ -1226,6 +1272,173 @@ void MulticastDelegateTests()
 	StaticFuncStructConstRef5MulticastDelegate(structParam, TEST_INT, TEST_INT, TEST_INT, TEST_INT);
 }
 
+// Records the order MulticastDelegate<> invokes its subscribers
+class OrderSubscriber
+{
+public:
+	void Record(int* log) { log[(*m_count)++] = m_id; }
+	void Subscribe(int* log) { Record(log); (*m_multicast) += MakeDelegate(m_next, &OrderSubscriber::Record); }
+	void Disconnect(int* log) { Record(log); m_connection.Disconnect(); }
+
+	int m_id;
+	int* m_count;
+	OrderSubscriber* m_next;
+	MulticastDelegate<void(int*)>* m_multicast;
+	DelegateConnection m_connection;
+};
+
+// Order, removal and growth of the MulticastDelegate<> invocation list
+void MulticastDelegateOrderTests()
+{
+	static const int SUBSCRIBERS = 11;
+	OrderSubscriber subscribers[SUBSCRIBERS + 1];
+	int log[SUBSCRIBERS * 2];
+	int count = 0;
+
+	MulticastDelegate<void(int*)> multicast;
+	for (int i = 0; i <= SUBSCRIBERS; i++)
+	{
+		subscribers[i].m_id = i;
+		subscribers[i].m_count = &count;
+		subscribers[i].m_next = &subscribers[SUBSCRIBERS];
+		subscribers[i].m_multicast = &multicast;
+	}
+
+	// Grow past the storage held inside the container, invoking in order
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		multicast += MakeDelegate(&subscribers[i], &OrderSubscriber::Record);
+	multicast(log);
+	ASSERT_TRUE(count == SUBSCRIBERS);
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		ASSERT_TRUE(log[i] == i);
+
+	// Remove the first, a middle and the last subscriber
+	multicast -= MakeDelegate(&subscribers[0], &OrderSubscriber::Record);
+	multicast -= MakeDelegate(&subscribers[5], &OrderSubscriber::Record);
+	multicast -= MakeDelegate(&subscribers[SUBSCRIBERS - 1], &OrderSubscriber::Record);
+	multicast -= MakeDelegate(&subscribers[5], &OrderSubscriber::Record);
+	count = 0;
+	multicast(log);
+	ASSERT_TRUE(count == SUBSCRIBERS - 3);
+	for (int i = 0, id = 1; i < count; i++, id++)
+	{
+		if (id == 5)
+			id++;
+		ASSERT_TRUE(log[i] == id);
+	}
+
+	// A subscriber registering another during invocation, growing the list
+	// while it is iterated. The new subscriber is invoked in the same pass.
+	multicast.Clear();
+	ASSERT_TRUE(multicast.Empty());
+	for (int i = 0; i < 4; i++)
+		multicast += MakeDelegate(&subscribers[i], &OrderSubscriber::Record);
+	multicast += MakeDelegate(&subscribers[4], &OrderSubscriber::Subscribe);
+	count = 0;
+	multicast(log);
+	ASSERT_TRUE(count == 6);
+	ASSERT_TRUE(log[4] == 4 && log[5] == SUBSCRIBERS);
+
+	multicast.Clear();
+	ASSERT_TRUE(!multicast);
+	count = 0;
+	multicast(log);
+	ASSERT_TRUE(count == 0);
+}
+
+// Unregister through the DelegateConnection handles returned by operator+= 
+template <class TMulticast>
+static void DelegateConnectionTests(TMulticast& multicast)
+{
+	static const int SUBSCRIBERS = 10;
+	OrderSubscriber subscribers[SUBSCRIBERS];
+	DelegateConnection connections[SUBSCRIBERS];
+	int log[SUBSCRIBERS];
+	int count = 0;
+	for (int i = 0; i < SUBSCRIBERS; i++)
+	{
+		subscribers[i].m_id = i;
+		subscribers[i].m_count = &count;
+	}
+
+	ASSERT_TRUE(!DelegateConnection().IsConnected());
+	for (int i = 0; i < SUBSCRIBERS; i++)
+	{
+		connections[i] = multicast += MakeDelegate(&subscribers[i], &OrderSubscriber::Record);
+		ASSERT_TRUE(connections[i].IsConnected());
+	}
+
+	// Disconnect every other subscriber; the rest stay in order
+	for (int i = 0; i < SUBSCRIBERS; i += 2)
+		connections[i].Disconnect();
+	connections[0].Disconnect();
+	multicast(log);
+	ASSERT_TRUE(count == SUBSCRIBERS / 2);
+	for (int i = 0; i < count; i++)
+		ASSERT_TRUE(log[i] == i * 2 + 1);
+	ASSERT_TRUE(!connections[0].IsConnected() && connections[1].IsConnected());
+
+	// operator-= disconnects the handle
+	multicast -= MakeDelegate(&subscribers[1], &OrderSubscriber::Record);
+	ASSERT_TRUE(!connections[1].IsConnected());
+
+	// A scoped connection unregisters when it goes out of scope
+	{
+		ScopedDelegateConnection scoped = multicast += MakeDelegate(&subscribers[0], &OrderSubscriber::Record);
+		ASSERT_TRUE(scoped.IsConnected());
+		count = 0;
+		multicast(log);
+		ASSERT_TRUE(count == SUBSCRIBERS / 2 && log[count - 1] == 0);
+	}
+	count = 0;
+	multicast(log);
+	ASSERT_TRUE(count == SUBSCRIBERS / 2 - 1);
+
+	// A subscriber disconnecting itself during invocation
+	subscribers[2].m_connection = multicast += MakeDelegate(&subscribers[2], &OrderSubscriber::Disconnect);
+	subscribers[4].m_connection = multicast += MakeDelegate(&subscribers[4], &OrderSubscriber::Record);
+	count = 0;
+	multicast(log);
+	ASSERT_TRUE(count == SUBSCRIBERS / 2 + 1 && log[count - 1] == 4);
+	count = 0;
+	multicast(log);
+	ASSERT_TRUE(count == SUBSCRIBERS / 2 && log[count - 1] == 4);
+	ASSERT_TRUE(!subscribers[2].m_connection.IsConnected());
+
+	// Empty once every subscriber is disconnected
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		connections[i].Disconnect();
+	subscribers[4].m_connection.Disconnect();
+	ASSERT_TRUE(multicast.Empty());
+	count = 0;
+	multicast(log);
+	ASSERT_TRUE(count == 0);
+
+	// Clear() disconnects the handles
+	connections[0] = multicast += MakeDelegate(&subscribers[0], &OrderSubscriber::Record);
+	multicast.Clear();
+	ASSERT_TRUE(!connections[0].IsConnected());
+	connections[0].Disconnect();
+}
+
+static void DelegateConnectionTests()
+{
+	MulticastDelegate<void(int*)> multicast;
+	DelegateConnectionTests(multicast);
+	MulticastDelegateSafe<void(int*)> multicastSafe;
+	DelegateConnectionTests(multicastSafe);
+
+	// A handle may outlive its container
+	OrderSubscriber subscriber;
+	DelegateConnection connection;
+	{
+		MulticastDelegateSafe<void(int*)> scopedMulticast;
+		connection = scopedMulticast += MakeDelegate(&subscriber, &OrderSubscriber::Record);
+	}
+	ASSERT_TRUE(!connection.IsConnected());
+	connection.Disconnect();
+}
+
 // Synchronous test of MulticastDelegateSafe<>
 void MulticastDelegateSafeTests()
 {
@@ -1311,6 +1524,170 @@ void MulticastDelegateSafeTests()
 	ASSERT_TRUE(!MemberFuncInt5MulticastDelegate);
 }
 
+#if USE_STD_THREADS
+// Calls back into the MulticastDelegateSafe<> invoking it, or blocks a publisher
+class SnapshotSubscriber
+{
+public:
+	SnapshotSubscriber() : m_calls(0), m_blocked(false), m_release(false), m_multicast(0) { }
+
+	void Count(int) { m_calls++; }
+	void Unsubscribe(int) { 
+		m_calls++; 
+		(*m_multicast) -= MakeDelegate(this, &SnapshotSubscriber::Unsubscribe); 
+	}
+	void Block(int) {
+		m_blocked = true;
+		while (!m_release)
+			std::this_thread::yield();
+	}
+
+	std::atomic<int> m_calls;
+	std::atomic<bool> m_blocked;
+	std::atomic<bool> m_release;
+	MulticastDelegateSafe<void(int)>* m_multicast;
+};
+
+// MulticastDelegateSafe<> publishing without holding the container lock
+void MulticastDelegateSafeSnapshotTests()
+{
+	MulticastDelegateSafe<void(int)> multicast;
+	SnapshotSubscriber a, b, blocker;
+	a.m_multicast = &multicast;
+
+	// A subscriber unsubscribing itself from within its callback
+	multicast += MakeDelegate(&a, &SnapshotSubscriber::Unsubscribe);
+	multicast += MakeDelegate(&b, &SnapshotSubscriber::Count);
+	multicast(TEST_INT);
+	ASSERT_TRUE(a.m_calls == 1 && b.m_calls == 1);
+	multicast(TEST_INT);
+	ASSERT_TRUE(a.m_calls == 1 && b.m_calls == 2);
+
+	// A publisher stuck in a slow subscriber does not block other threads 
+	// registering, unregistering or publishing
+	multicast += MakeDelegate(&blocker, &SnapshotSubscriber::Block);
+	std::thread publisher([&multicast]() { multicast(TEST_INT); });
+	while (!blocker.m_blocked)
+		std::this_thread::yield();
+	multicast -= MakeDelegate(&blocker, &SnapshotSubscriber::Block);
+	multicast += MakeDelegate(&a, &SnapshotSubscriber::Count);
+	multicast(TEST_INT);
+	ASSERT_TRUE(a.m_calls == 2 && b.m_calls == 4);
+
+	// The blocked publisher finishes its own snapshot, without the new subscriber
+	blocker.m_release = true;
+	publisher.join();
+	ASSERT_TRUE(a.m_calls == 2 && b.m_calls == 4);
+
+	multicast.Clear();
+	ASSERT_TRUE(multicast.Empty());
+	ASSERT_TRUE(!multicast);
+	multicast(TEST_INT);
+	ASSERT_TRUE(a.m_calls == 2 && b.m_calls == 4);
+}
+
+// Counts the calls made by a MulticastDelegate<> invoked in parallel
+class ParallelSubscriber
+{
+public:
+	ParallelSubscriber() : m_calls(0), m_badArgs(0) { }
+
+	void Count(int val, const StructParam& param) {
+		if (val != TEST_INT || param.val != TEST_INT)
+			m_badArgs++;
+		m_calls++;
+	}
+	void Disconnect(int val, const StructParam& param) {
+		Count(val, param);
+		m_connection.Disconnect();
+	}
+
+	std::atomic<int> m_calls;
+	std::atomic<int> m_badArgs;
+	DelegateConnection m_connection;
+};
+
+// Invokes a MulticastDelegate<> in parallel from a thread of the same pool
+static void ParallelInvokeFunc(MulticastDelegate<void(int, const StructParam&)>* multicast)
+{
+	StructParam param;
+	param.val = TEST_INT;
+	(*multicast)(TEST_INT, param);
+}
+
+// MulticastDelegate<> splitting its invocation list across a thread pool
+void MulticastDelegateParallelTests()
+{
+	const int SUBSCRIBERS = 37;
+	const int INVOKES = 20;
+	DelegateThreadPool pool("ParallelPool", 4);
+	pool.CreateThreads();
+
+	MulticastDelegate<void(int, const StructParam&)> multicast;
+	ParallelSubscriber subscribers[SUBSCRIBERS];
+	ASSERT_TRUE(multicast.GetParallelThread() == 0);
+	multicast.SetParallel(&pool, pool.GetThreadCount() + 1);
+	ASSERT_TRUE(multicast.GetParallelThread() == &pool);
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		subscribers[i].m_connection = multicast += MakeDelegate(&subscribers[i], &ParallelSubscriber::Count);
+
+	// Every delegate is called exactly once before the invocation returns
+	StructParam param;
+	param.val = TEST_INT;
+	for (int n = 1; n <= INVOKES; n++)
+	{
+		multicast(TEST_INT, param);
+		for (int i = 0; i < SUBSCRIBERS; i++)
+			ASSERT_TRUE(subscribers[i].m_calls == n);
+	}
+
+	// Disconnected delegates are skipped, and a callback may disconnect itself
+	for (int i = 0; i < SUBSCRIBERS; i += 2)
+		subscribers[i].m_connection.Disconnect();
+	ParallelSubscriber self;
+	self.m_connection = multicast += MakeDelegate(&self, &ParallelSubscriber::Disconnect);
+	multicast(TEST_INT, param);
+	multicast(TEST_INT, param);
+	ASSERT_TRUE(self.m_calls == 1);
+	for (int i = 0; i < SUBSCRIBERS; i++)
+		ASSERT_TRUE(subscribers[i].m_calls == INVOKES + (i % 2 ? 2 : 0));
+
+	// Invoked from a pool thread, the caller runs any parts the pool has not
+	// started rather than waiting on its own queue
+	DelegateThreadPool single("ParallelSinglePool", 1);
+	single.CreateThreads();
+	multicast.SetParallel(&single, 4);
+	DelegateFreeAsyncWait1<MulticastDelegate<void(int, const StructParam&)>*> invoke = 
+		MakeDelegate(&ParallelInvokeFunc, &single, WAIT_INFINITE);
+	invoke(&multicast);
+	ASSERT_TRUE(invoke.IsSuccess());
+	for (int i = 1; i < SUBSCRIBERS; i += 2)
+		ASSERT_TRUE(subscribers[i].m_calls == INVOKES + 3);
+	single.ExitThreads();
+
+	// Parts rejected by a full queue are run by the calling thread
+	WorkerThread full("ParallelFullThread");
+	full.SetCapacity(1, WorkerThread::OVERFLOW_FAIL);
+	full.CreateThread();
+	multicast.SetParallel(&full, 8);
+	multicast(TEST_INT, param);
+	for (int i = 1; i < SUBSCRIBERS; i += 2)
+		ASSERT_TRUE(subscribers[i].m_calls == INVOKES + 4);
+	full.ExitThread();
+
+	// Back to sequential, in registration order
+	multicast.SetParallel(0, 0);
+	ASSERT_TRUE(multicast.GetParallelThread() == 0);
+	multicast(TEST_INT, param);
+	for (int i = 0; i < SUBSCRIBERS; i++)
+	{
+		ASSERT_TRUE(subscribers[i].m_calls == INVOKES + (i % 2 ? 5 : 0));
+		ASSERT_TRUE(subscribers[i].m_badArgs == 0);
+	}
+	pool.ExitThreads();
+}
+#endif
+
 // Asynchronous test of MulticastDelegateSafe<>
 void MulticastDelegateSafeAsyncTests()
 {
@@ -1824,7 +2201,6 @@ void MulticastDelegateSafeAsyncTests()
 
 void DelegateMemberSpTests()
 {
-#if USE_CPLUSPLUS_11
 	std::shared_ptr<TestClass0> testClass0(new TestClass0());
 	auto DelegateMemberSp0 = MakeDelegate(testClass0, &TestClass0::MemberFunc0);
 	DelegateMemberSp0();
@@ -1848,12 +2224,10 @@ void DelegateMemberSpTests()
 	std::shared_ptr<TestClass5> testClass5(new TestClass5());
 	auto DelegateMemberSp5 = MakeDelegate(testClass5, &TestClass5::MemberFuncInt5);
 	DelegateMemberSp5(TEST_INT, TEST_INT, TEST_INT, TEST_INT, TEST_INT);
-#endif
 }
 
 void DelegateMemberAsyncSpTests()
 {
-#if USE_CPLUSPLUS_11
 	std::shared_ptr<TestClass0> testClass0(new TestClass0());
 	auto DelegateMemberAsyncSp0 = MakeDelegate(testClass0, &TestClass0::MemberFunc0, &testThread);
 	DelegateMemberAsyncSp0();
@@ -1877,12 +2251,10 @@ void DelegateMemberAsyncSpTests()
 	std::shared_ptr<TestClass5> testClass5(new TestClass5());
 	auto DelegateMemberAsyncSp5 = MakeDelegate(testClass5, &TestClass5::MemberFuncInt5, &testThread);
 	DelegateMemberAsyncSp5(TEST_INT, TEST_INT, TEST_INT, TEST_INT, TEST_INT);
-#endif
 }
 
 void DelegateMemberAsyncWaitTests()
 {
-#if USE_CPLUSPLUS_11
 	const int LOOP_CNT = 100;
 	StructParam structParam;
 	structParam.val = TEST_INT;
@@ -2547,6 +2919,1739 @@ void DelegateMemberAsyncWaitTests()
 	MemberFuncIntWithReturn5Delegate = MakeDelegate(&testClass5, &TestClass5::MemberFuncIntWithReturn5, &testThread, 1);
 	for (int i = 0; i < LOOP_CNT; i++)
 		int ret = MemberFuncIntWithReturn5Delegate(TEST_INT, TEST_INT, TEST_INT, TEST_INT, TEST_INT);
+}
+
+#if USE_STD_THREADS
+static const int MPSC_PRODUCERS = 8;
+static const int MPSC_MSGS_PER_PRODUCER = 10000;
+static int mpscLastSeq[MPSC_PRODUCERS];
+static int mpscRecvCnt = 0;
+
+// Called on the consumer thread only. Messages from each producer must arrive in order.
+void MpscRecvFunc(int producer, int seq)
+{
+	ASSERT_TRUE(seq == mpscLastSeq[producer] + 1);
+	mpscLastSeq[producer] = seq;
+	mpscRecvCnt++;
+}
+
+void MpscProducer(int producer, WorkerThread* thread)
+{
+	DelegateFreeAsync2<int, int> delegate = MakeDelegate(&MpscRecvFunc, thread);
+	for (int seq = 0; seq < MPSC_MSGS_PER_PRODUCER; seq++)
+		delegate(producer, seq);
+}
+
+// Hammer a worker thread's queue from many producers at once
+void WorkerThreadHammer(WorkerThread& thread)
+{
+	mpscRecvCnt = 0;
+	for (int i = 0; i < MPSC_PRODUCERS; i++)
+		mpscLastSeq[i] = -1;
+
+	std::vector<std::thread> producers;
+	for (int i = 0; i < MPSC_PRODUCERS; i++)
+		producers.push_back(std::thread(&MpscProducer, i, &thread));
+	for (size_t i = 0; i < producers.size(); i++)
+		producers[i].join();
+
+	// Blocking call completes after every earlier message is processed
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+	flush();
+	ASSERT_TRUE(flush.IsSuccess());
+
+	ASSERT_TRUE(mpscRecvCnt == MPSC_PRODUCERS * MPSC_MSGS_PER_PRODUCER);
+	for (int i = 0; i < MPSC_PRODUCERS; i++)
+		ASSERT_TRUE(mpscLastSeq[i] == MPSC_MSGS_PER_PRODUCER - 1);
+
+	// Park and wake the consumer repeatedly with a lightly loaded queue
+	for (int i = 0; i < 100; i++)
+	{
+		flush();
+		ASSERT_TRUE(flush.IsSuccess());
+	}
+}
+
+void WorkerThreadLockFreeTests()
+{
+	WorkerThread lockFreeThread("LockFreeQueueThread", WorkerThread::QUEUE_LOCK_FREE);
+	ASSERT_TRUE(lockFreeThread.GetQueueType() == WorkerThread::QUEUE_LOCK_FREE);
+	lockFreeThread.CreateThread();
+	WorkerThreadHammer(lockFreeThread);
+	lockFreeThread.ExitThread();
+}
+
+void WorkerThreadBatchDrainTests()
+{
+	// Capped batch
+	WorkerThread batchThread("BatchDrainThread");
+	batchThread.SetBatchDrain(16);
+	ASSERT_TRUE(batchThread.GetBatchDrain() == 16);
+	batchThread.CreateThread();
+	WorkerThreadHammer(batchThread);
+	batchThread.ExitThread();
+
+	// Uncapped batch. Recreate the thread to check exit leaves the queue intact.
+	batchThread.SetBatchDrain(0);
+	batchThread.CreateThread();
+	WorkerThreadHammer(batchThread);
+	batchThread.ExitThread();
+}
+#endif
+
+#if USE_STD_THREADS
+static std::atomic<bool> priorityGate(false);
+static std::atomic<bool> priorityGateEntered(false);
+static std::vector<int> priorityOrder;
+static std::atomic<int> priorityRunCnt(0);
+
+// Holds the worker thread until released so that messages queue up behind it
+void PriorityGateFunc()
+{
+	priorityGateEntered = true;
+	while (!priorityGate.load())
+		std::this_thread::yield();
+}
+
+// Block the worker thread in PriorityGateFunc() and reset the recorded order
+static void ClosePriorityGate(WorkerThread& thread)
+{
+	priorityOrder.clear();
+	priorityRunCnt = 0;
+	priorityGate = false;
+	priorityGateEntered = false;
+	MakeDelegate(&PriorityGateFunc, &thread)();
+	while (!priorityGateEntered.load())
+		std::this_thread::yield();
+}
+
+// Called on the worker thread only
+void PriorityRecordFunc(int id)
+{
+	priorityOrder.push_back(id);
+	priorityRunCnt++;
+}
+
+// Release the worker thread and wait for it to record cnt messages
+static void OpenPriorityGate(int cnt)
+{
+	priorityGate = true;
+	while (priorityRunCnt.load() < cnt)
+		std::this_thread::yield();
+}
+
+// Queue messages behind a blocked worker thread, then release it and return 
+// the order the messages ran in
+static void RunPriorityOrder(WorkerThread& thread, DelegatePriority* priorities, int cnt)
+{
+	ClosePriorityGate(thread);
+
+	for (int i = 0; i < cnt; i++)
+	{
+		DelegateFreeAsync1<int> delegate = MakeDelegate(&PriorityRecordFunc, &thread);
+		delegate.SetPriority(priorities[i]);
+		ASSERT_TRUE(delegate.GetPriority() == priorities[i]);
+		delegate(i);
+	}
+
+	OpenPriorityGate(cnt);
+	ASSERT_TRUE(priorityOrder.size() == (size_t)cnt);
+}
+
+static void PriorityOrderTests(WorkerThread& thread)
+{
+	// Higher priorities first, first-in first-out within a priority
+	const int CNT = 9;
+	DelegatePriority priorities[CNT];
+	for (int i = 0; i < CNT; i++)
+		priorities[i] = (DelegatePriority)(i % PRIORITY_LEVELS);
+	RunPriorityOrder(thread, priorities, CNT);
+	const int expected[CNT] = { 2, 5, 8, 1, 4, 7, 0, 3, 6 };
+	for (int i = 0; i < CNT; i++)
+		ASSERT_TRUE(priorityOrder[i] == expected[i]);
+
+	// A scope overrides the delegate's default priority for one call
+	ClosePriorityGate(thread);
+	DelegateFreeAsync1<int> delegate = MakeDelegate(&PriorityRecordFunc, &thread);
+	delegate.SetPriority(PRIORITY_LOW);
+	delegate(0);
+	{
+		DelegatePriorityScope scope(PRIORITY_HIGH);
+		delegate(1);
+		{
+			DelegatePriorityScope inner(PRIORITY_NORMAL);
+			delegate(2);
+		}
+		delegate(3);
+	}
+	delegate(4);
+	ASSERT_TRUE(delegate.GetPriority() == PRIORITY_LOW);
+	OpenPriorityGate(5);
+	const int expectedScope[] = { 1, 3, 2, 0, 4 };
+	ASSERT_TRUE(priorityOrder.size() == 5);
+	for (int i = 0; i < 5; i++)
+		ASSERT_TRUE(priorityOrder[i] == expectedScope[i]);
+}
+
+static void PriorityStarvationTests(WorkerThread& thread, UINT limit)
+{
+	// One low priority message queued ahead of a flood of high priority messages
+	const int CNT = 21;
+	DelegatePriority priorities[CNT];
+	priorities[0] = PRIORITY_LOW;
+	for (int i = 1; i < CNT; i++)
+		priorities[i] = PRIORITY_HIGH;
+	RunPriorityOrder(thread, priorities, CNT);
+
+	// The low priority message is passed over at most limit times
+	size_t pos = 0;
+	while (priorityOrder[pos] != 0)
+		pos++;
+	ASSERT_TRUE(pos == (limit ? limit : CNT - 1));
+}
+
+static void PriorityFloodTests(WorkerThread& thread)
+{
+	// A high priority message posted behind a flood of low priority messages
+	// runs before all of them, which then run in order
+	const int FLOOD = 200;
+	DelegatePriority priorities[FLOOD + 1];
+	for (int i = 0; i < FLOOD; i++)
+		priorities[i] = PRIORITY_LOW;
+	priorities[FLOOD] = PRIORITY_HIGH;
+	RunPriorityOrder(thread, priorities, FLOOD + 1);
+	ASSERT_TRUE(priorityOrder[0] == FLOOD);
+	for (int i = 0; i < FLOOD; i++)
+		ASSERT_TRUE(priorityOrder[i + 1] == i);
+}
+
+void WorkerThreadPriorityTests()
+{
+	WorkerThread lockedThread("PriorityLockedThread");
+	lockedThread.CreateThread();
+	PriorityOrderTests(lockedThread);
+	PriorityStarvationTests(lockedThread, lockedThread.GetStarvationLimit());
+	PriorityFloodTests(lockedThread);
+	lockedThread.ExitThread();
+
+	lockedThread.SetStarvationLimit(4);
+	ASSERT_TRUE(lockedThread.GetStarvationLimit() == 4);
+	lockedThread.CreateThread();
+	PriorityStarvationTests(lockedThread, 4);
+	lockedThread.ExitThread();
+
+	lockedThread.SetStarvationLimit(0);
+	lockedThread.CreateThread();
+	PriorityStarvationTests(lockedThread, 0);
+	lockedThread.ExitThread();
+
+	WorkerThread lockFreeThread("PriorityLockFreeThread", WorkerThread::QUEUE_LOCK_FREE);
+	lockFreeThread.CreateThread();
+	PriorityOrderTests(lockFreeThread);
+	PriorityFloodTests(lockFreeThread);
+	lockFreeThread.ExitThread();
+
+	lockFreeThread.SetStarvationLimit(4);
+	lockFreeThread.CreateThread();
+	PriorityStarvationTests(lockFreeThread, 4);
+	lockFreeThread.ExitThread();
+
+	// An uncapped batch is drained in priority order
+	WorkerThread batchThread("PriorityBatchThread");
+	batchThread.SetBatchDrain(0);
+	batchThread.CreateThread();
+	PriorityOrderTests(batchThread);
+	batchThread.ExitThread();
+}
+#endif
+
+#if USE_STD_THREADS
+// Fill a blocked worker thread's queue past its capacity
+static void OverflowDispatch(WorkerThread& thread, int cnt, bool* dispatched)
+{
+	ClosePriorityGate(thread);
+	DelegateFreeAsync1<int> delegate = MakeDelegate(&PriorityRecordFunc, &thread);
+	for (int i = 0; i < cnt; i++)
+	{
+		delegate(i);
+		dispatched[i] = delegate.IsDispatched();
+	}
+}
+
+static std::atomic<int> blockedSent(0);
+
+static void OverflowBlockTests(WorkerThread& thread, int capacity)
+{
+	const int CNT = 10;
+	ClosePriorityGate(thread);
+	blockedSent = 0;
+
+	std::thread producer([&thread]() {
+		DelegateFreeAsync1<int> delegate = MakeDelegate(&PriorityRecordFunc, &thread);
+		for (int i = 0; i < CNT; i++)
+		{
+			delegate(i);
+			ASSERT_TRUE(delegate.IsDispatched());
+			blockedSent++;
+		}
+	});
+
+	// The producer stalls once the queue is full
+	while (blockedSent.load() < capacity)
+		std::this_thread::yield();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	ASSERT_TRUE(blockedSent.load() == capacity);
+
+	OpenPriorityGate(CNT);
+	producer.join();
+	for (int i = 0; i < CNT; i++)
+		ASSERT_TRUE(priorityOrder[i] == i);
+}
+
+static void OverflowFailTests(WorkerThread& thread, int capacity)
+{
+	const int CNT = 6;
+	bool dispatched[CNT];
+	size_t rejected = thread.GetRejectedCount();
+	OverflowDispatch(thread, CNT, dispatched);
+	for (int i = 0; i < CNT; i++)
+		ASSERT_TRUE(dispatched[i] == (i < capacity));
+	ASSERT_TRUE(thread.GetRejectedCount() == rejected + CNT - capacity);
+
+	// A blocking call to a full queue returns at once without invoking the target
+	DelegateFreeAsyncWait1<int, void> wait = MakeDelegate(&PriorityRecordFunc, &thread, WAIT_INFINITE);
+	wait(-1);
+	ASSERT_TRUE(!wait.IsDispatched());
+	ASSERT_TRUE(!wait.IsSuccess());
+
+	OpenPriorityGate(capacity);
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT_TRUE(priorityOrder.size() == (size_t)capacity);
+	for (int i = 0; i < capacity; i++)
+		ASSERT_TRUE(priorityOrder[i] == i);
+}
+
+static void OverflowDropTests(WorkerThread& thread, int capacity, bool dropOldest)
+{
+	const int CNT = 6;
+	bool dispatched[CNT];
+	size_t dropped = thread.GetDroppedCount();
+	OverflowDispatch(thread, CNT, dispatched);
+
+	// Dropping is not reported to the caller
+	for (int i = 0; i < CNT; i++)
+		ASSERT_TRUE(dispatched[i]);
+	ASSERT_TRUE(thread.GetDroppedCount() == dropped + CNT - capacity);
+
+	OpenPriorityGate(capacity);
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT_TRUE(priorityOrder.size() == (size_t)capacity);
+	int first = dropOldest ? CNT - capacity : 0;
+	for (int i = 0; i < capacity; i++)
+		ASSERT_TRUE(priorityOrder[i] == first + i);
+}
+
+void WorkerThreadCapacityTests()
+{
+	const int CAPACITY = 4;
+	const WorkerThread::QueueType types[] = { WorkerThread::QUEUE_LOCKED, WorkerThread::QUEUE_LOCK_FREE };
+	for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++)
+	{
+		WorkerThread thread("CapacityThread", types[t]);
+		ASSERT_TRUE(thread.GetCapacity() == 0);
+
+		thread.SetCapacity(CAPACITY);
+		ASSERT_TRUE(thread.GetCapacity() == CAPACITY);
+		ASSERT_TRUE(thread.GetOverflowPolicy() == WorkerThread::OVERFLOW_BLOCK);
+		thread.CreateThread();
+		OverflowBlockTests(thread, CAPACITY);
+		WorkerThreadHammer(thread);
+		ASSERT_TRUE(thread.GetRejectedCount() == 0);
+		thread.ExitThread();
+
+		thread.SetCapacity(CAPACITY, WorkerThread::OVERFLOW_FAIL);
+		thread.CreateThread();
+		OverflowFailTests(thread, CAPACITY);
+		thread.ExitThread();
+
+		thread.SetCapacity(CAPACITY, WorkerThread::OVERFLOW_DROP_NEWEST);
+		thread.CreateThread();
+		OverflowDropTests(thread, CAPACITY, false);
+		thread.ExitThread();
+
+		if (types[t] == WorkerThread::QUEUE_LOCKED)
+		{
+			thread.SetCapacity(CAPACITY, WorkerThread::OVERFLOW_DROP_OLDEST);
+			thread.CreateThread();
+			OverflowDropTests(thread, CAPACITY, true);
+			thread.ExitThread();
+		}
+
+		// A blocked dispatcher is released with a rejection when the thread exits
+		size_t rejected = thread.GetRejectedCount();
+		thread.SetCapacity(1, WorkerThread::OVERFLOW_BLOCK);
+		thread.CreateThread();
+		ClosePriorityGate(thread);
+		DelegateFreeAsync1<int> delegate = MakeDelegate(&PriorityRecordFunc, &thread);
+		delegate(0);
+		std::thread blocked([&delegate]() { 
+			delegate(1); 
+			ASSERT_TRUE(!delegate.IsDispatched());
+		});
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		std::thread exiting([&thread]() { thread.ExitThread(); });
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		priorityGate = true;
+		blocked.join();
+		exiting.join();
+		ASSERT_TRUE(thread.GetRejectedCount() == rejected + 1);
+		ASSERT_TRUE(priorityOrder.size() == 1);
+	}
+}
+#endif
+
+#if USE_STD_THREADS
+static std::atomic<int> timerExpiredCnt(0);
+static std::mutex timerIdLock;
+static std::set<std::thread::id> timerIds;
+
+void TimerTestExpired()
+{
+	std::lock_guard<std::mutex> lk(timerIdLock);
+	timerIds.insert(std::this_thread::get_id());
+	timerExpiredCnt++;
+}
+
+static bool WaitTimerExpiredCnt(int cnt, int timeoutMs)
+{
+	for (int i = 0; i < timeoutMs && timerExpiredCnt.load() < cnt; i++)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	return timerExpiredCnt.load() >= cnt;
+}
+
+static void TimerWheelExpiryTests(unsigned long start)
+{
+	// Deadlines on each level, on level boundaries, past due and beyond the range
+	const unsigned long deltas[] = { 1, 2, 63, 64, 65, 127, 4095, 4096, 4097, 
+		262143, 262144, 300000, (1UL << 24) - 1, (1UL << 24) + 5, 3 * (1UL << 24) };
+	const int cnt = sizeof(deltas) / sizeof(deltas[0]);
+
+	TimerWheel wheel(start);
+	TimerWheelNode nodes[cnt];
+	for (int i = 0; i < cnt; i++)
+		wheel.Schedule(&nodes[i], start + deltas[i]);
+
+	TimerWheelNode pastDue;
+	wheel.Schedule(&pastDue, start - 5);
+
+	// A stopped node never expires
+	TimerWheelNode stopped;
+	wheel.Schedule(&stopped, start + 100);
+	stopped.Unlink();
+
+	// The wheel never sleeps past a deadline
+	ASSERT_TRUE(wheel.NextEvent() == 1);
+
+	TimerWheelList expired;
+	wheel.Advance(start + 1, expired);
+	ASSERT_TRUE(expired.PopFront() == &nodes[0]);
+	ASSERT_TRUE(expired.PopFront() == &pastDue);
+	ASSERT_TRUE(expired.Empty());
+
+	// Each node expires on exactly its tick
+	for (int i = 1; i < cnt; i++)
+	{
+		unsigned long next = wheel.NextEvent();
+		ASSERT_TRUE(next != 0 && next <= deltas[i] - (wheel.GetNow() - start));
+
+		wheel.Advance(start + deltas[i] - 1, expired);
+		ASSERT_TRUE(expired.Empty());
+		wheel.Advance(start + deltas[i], expired);
+		ASSERT_TRUE(expired.PopFront() == &nodes[i]);
+		ASSERT_TRUE(expired.Empty());
+		ASSERT_TRUE(!nodes[i].IsLinked());
+	}
+	ASSERT_TRUE(!stopped.IsLinked());
+	ASSERT_TRUE(wheel.NextEvent() == 0);
+}
+
+void TimerWheelTests()
+{
+	TimerWheelExpiryTests(0);
+	TimerWheelExpiryTests(1000);
+
+	// Tick counter rollover
+	TimerWheelExpiryTests((unsigned long)-100);
+
+	// Many nodes expire in deadline order and can be moved while scheduled
+	const int cnt = 10000;
+	std::vector<TimerWheelNode> nodes(cnt);
+	TimerWheel wheel(0);
+	for (int i = 0; i < cnt; i++)
+		wheel.Schedule(&nodes[i], 1 + (i * 7919) % 500000);
+	for (int i = 0; i < cnt; i += 2)
+		wheel.Schedule(&nodes[i], wheel.GetNow() + 1 + (i * 104729) % 500000);
+
+	TimerWheelList expired;
+	unsigned long last = 0;
+	int expiredCnt = 0;
+	while (wheel.NextEvent() != 0)
+	{
+		wheel.Advance(wheel.GetNow() + wheel.NextEvent(), expired);
+		TimerWheelNode* node;
+		while ((node = expired.PopFront()) != NULL)
+		{
+			ASSERT_TRUE(node->GetExpire() == wheel.GetNow());
+			ASSERT_TRUE(node->GetExpire() >= last);
+			last = node->GetExpire();
+			expiredCnt++;
+		}
+	}
+	ASSERT_TRUE(expiredCnt == cnt);
+}
+
+static Timer* oneShotTimer = NULL;
+
+void TimerTestOneShot()
+{
+	// A timer's callback runs without a lock held, so it may stop its timer
+	oneShotTimer->Stop();
+	TimerTestExpired();
+}
+
+void TimerTestBusy()
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+static std::atomic<bool> timerSlowStarted(false);
+static std::atomic<bool> timerSlowDone(false);
+
+void TimerTestSlow()
+{
+	timerSlowStarted = true;
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	timerSlowDone = true;
+}
+
+static void TimerDestroyInCallbackTests(Timer* timer)
+{
+	timerSlowStarted = false;
+	timerSlowDone = false;
+	timer->Expired = MakeDelegate(&TimerTestSlow);
+	timer->Start(5);
+	for (int i = 0; i < 1000 && !timerSlowStarted.load(); i++)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	ASSERT_TRUE(timerSlowStarted.load());
+
+	// Destroying the timer on another thread waits for its callback to return
+	delete timer;
+	ASSERT_TRUE(timerSlowDone.load());
+}
+
+static void TimerBoundTests(WorkerThread::QueueType queueType)
+{
+	WorkerThread thread("TimerBoundThread", queueType);
+	thread.CreateThread();
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+
+	// A synchronous Expired delegate runs on the bound thread
+	timerExpiredCnt = 0;
+	timerIds.clear();
+	{
+		Timer timer(thread);
+		timer.Expired = MakeDelegate(&TimerTestExpired);
+		timer.Start(5);
+		ASSERT_TRUE(WaitTimerExpiredCnt(5, 1000));
+		timer.Stop();
+		flush();
+	}
+	ASSERT_TRUE(timerIds.size() == 1 && *timerIds.begin() == thread.GetThreadId());
+
+	// Timers expire between messages while the thread is busy
+	timerExpiredCnt = 0;
+	{
+		Timer timer(thread);
+		timer.Expired = MakeDelegate(&TimerTestExpired);
+		timer.Start(10);
+		DelegateFreeAsync0 busy = MakeDelegate(&TimerTestBusy, &thread);
+		for (int i = 0; i < 200; i++)
+			busy();
+		flush();
+		timer.Stop();
+		flush();
+	}
+	ASSERT_TRUE(timerExpiredCnt.load() >= 5);
+
+	// The callback may stop its own timer
+	timerExpiredCnt = 0;
+	{
+		Timer timer(thread);
+		oneShotTimer = &timer;
+		timer.Expired = MakeDelegate(&TimerTestOneShot);
+		timer.Start(5);
+		ASSERT_TRUE(WaitTimerExpiredCnt(1, 1000));
+		std::this_thread::sleep_for(std::chrono::milliseconds(30));
+		ASSERT_TRUE(timerExpiredCnt.load() == 1);
+		ASSERT_TRUE(!timer.Enabled());
+		flush();
+		oneShotTimer = NULL;
+	}
+
+	TimerDestroyInCallbackTests(new Timer(thread));
+
+	thread.ExitThread();
+}
+
+void TimerTests()
+{
+	WorkerThread timerThread("TimerTestThread");
+	timerThread.CreateThread();
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &timerThread, WAIT_INFINITE);
+
+	// An asynchronous Expired delegate runs on its target thread only
+	timerExpiredCnt = 0;
+	timerIds.clear();
+	Timer timer;
+	timer.Expired = MakeDelegate(&TimerTestExpired, &timerThread);
+	timer.Start(20);
+	std::this_thread::sleep_for(std::chrono::milliseconds(210));
+	timer.Stop();
+	flush();
+	int cnt = timerExpiredCnt.load();
+	ASSERT_TRUE(cnt >= 5 && cnt <= 11);
+	ASSERT_TRUE(timerIds.size() == 1 && *timerIds.begin() == timerThread.GetThreadId());
+
+	// A stopped timer does not expire
+	std::this_thread::sleep_for(std::chrono::milliseconds(60));
+	ASSERT_TRUE(timerExpiredCnt.load() == cnt);
+
+	// Restarting with a shorter timeout wakes the service for the new deadline
+	timerExpiredCnt = 0;
+	timer.Start(10000);
+	timer.Start(10);
+	ASSERT_TRUE(WaitTimerExpiredCnt(1, 1000));
+	timer.Stop();
+	flush();
+
+	// Synchronous Expired delegates for every timer run on the one service thread
+	timerExpiredCnt = 0;
+	timerIds.clear();
+	Timer syncTimers[4];
+	for (int i = 0; i < 4; i++)
+	{
+		syncTimers[i].Expired = MakeDelegate(&TimerTestExpired);
+		syncTimers[i].Start(5 + i);
+	}
+	ASSERT_TRUE(WaitTimerExpiredCnt(20, 1000));
+	for (int i = 0; i < 4; i++)
+		syncTimers[i].Stop();
+	{
+		std::lock_guard<std::mutex> lk(timerIdLock);
+		ASSERT_TRUE(timerIds.size() == 1);
+		ASSERT_TRUE(*timerIds.begin() != std::this_thread::get_id());
+		ASSERT_TRUE(*timerIds.begin() != timerThread.GetThreadId());
+	}
+
+	// A synchronous callback on the service thread may stop its own timer
+	timerExpiredCnt = 0;
+	{
+		Timer oneShot;
+		oneShotTimer = &oneShot;
+		oneShot.Expired = MakeDelegate(&TimerTestOneShot);
+		oneShot.Start(5);
+		ASSERT_TRUE(WaitTimerExpiredCnt(1, 1000));
+		std::this_thread::sleep_for(std::chrono::milliseconds(30));
+		ASSERT_TRUE(timerExpiredCnt.load() == 1);
+		ASSERT_TRUE(!oneShot.Enabled());
+		oneShotTimer = NULL;
+	}
+
+	TimerDestroyInCallbackTests(new Timer());
+
+	TimerBoundTests(WorkerThread::QUEUE_LOCKED);
+	TimerBoundTests(WorkerThread::QUEUE_LOCK_FREE);
+
+	timerThread.ExitThread();
+}
+#endif
+
+#if USE_STD_THREADS
+static std::atomic<int> poolRunCnt(0);
+static std::mutex poolIdLock;
+static std::set<std::thread::id> poolIds;
+static DelegateThreadPool* testPool = NULL;
+
+void PoolFunc(int sleepMs)
+{
+	if (sleepMs)
+		std::this_thread::sleep_for(std::chrono::milliseconds(sleepMs));
+	{
+		std::lock_guard<std::mutex> lk(poolIdLock);
+		poolIds.insert(std::this_thread::get_id());
+	}
+	poolRunCnt++;
+}
+
+// Runs on a pool thread so every message lands on that thread's own queue
+void PoolSpawnFunc(int cnt)
+{
+	ASSERT_TRUE(testPool->IsPoolThread());
+	DelegateFreeAsync1<int> delegate = MakeDelegate(&PoolFunc, testPool);
+	for (int i = 0; i < cnt; i++)
+		delegate(1);
+}
+
+static bool WaitPoolRunCnt(int cnt)
+{
+	for (int i = 0; i < 10000 && poolRunCnt.load() < cnt; i++)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	return poolRunCnt.load() == cnt;
+}
+
+void DelegateThreadPoolTests()
+{
+	const int POOL_THREADS = 4;
+	DelegateThreadPool pool("DelegateUnitTestsPool", POOL_THREADS);
+	ASSERT_TRUE(pool.GetThreadCount() == POOL_THREADS);
+	ASSERT_TRUE(!pool.IsPoolThread());
+	pool.CreateThreads();
+
+	// Many producers outside the pool
+	poolRunCnt = 0;
+	std::vector<std::thread> producers;
+	for (int i = 0; i < 4; i++)
+		producers.push_back(std::thread([&pool]() {
+			DelegateFreeAsync1<int> delegate = MakeDelegate(&PoolFunc, &pool);
+			for (int j = 0; j < 10000; j++)
+				delegate(0);
+		}));
+	for (size_t i = 0; i < producers.size(); i++)
+		producers[i].join();
+	ASSERT_TRUE(WaitPoolRunCnt(40000));
+
+	// Slow work queued on one pool thread is stolen by the idle threads
+	const int SPAWN_CNT = 64;
+	poolRunCnt = 0;
+	poolIds.clear();
+	testPool = &pool;
+	DelegateFreeAsync1<int> spawn = MakeDelegate(&PoolSpawnFunc, &pool);
+	spawn(SPAWN_CNT);
+	ASSERT_TRUE(WaitPoolRunCnt(SPAWN_CNT));
+	ASSERT_TRUE(poolIds.size() > 1);
+
+	// Exit runs pending messages first
+	poolRunCnt = 0;
+	DelegateFreeAsync1<int> delegate = MakeDelegate(&PoolFunc, &pool);
+	for (int i = 0; i < 1000; i++)
+		delegate(0);
+	pool.ExitThreads();
+	ASSERT_TRUE(poolRunCnt.load() == 1000);
+	testPool = NULL;
+}
+
+static const int STRANDS = 16;
+static const int STRAND_PRODUCERS = 4;
+static const int STRAND_MSGS = 500;
+static std::atomic<int> strandActive[STRANDS];
+static int strandLastSeq[STRANDS][STRAND_PRODUCERS];
+static std::atomic<int> strandRunCnt(0);
+
+// Called on a pool thread. Each strand must never run two delegates at once, 
+// and must run each producer's delegates in order.
+void StrandFunc(int strand, int producer, int seq)
+{
+	ASSERT_TRUE(strandActive[strand].exchange(1) == 0);
+	ASSERT_TRUE(seq == strandLastSeq[strand][producer] + 1);
+	strandLastSeq[strand][producer] = seq;
+	std::this_thread::yield();
+	strandActive[strand] = 0;
+	strandRunCnt++;
+}
+
+void DelegateStrandTests()
+{
+	DelegateThreadPool pool("DelegateStrandPool", 4);
+	pool.CreateThreads();
+
+	std::vector<DelegateStrand*> strands;
+	for (int i = 0; i < STRANDS; i++)
+	{
+		strands.push_back(new DelegateStrand(&pool));
+		ASSERT_TRUE(strands[i]->GetExecutor() == &pool);
+		strandActive[i] = 0;
+		for (int j = 0; j < STRAND_PRODUCERS; j++)
+			strandLastSeq[i][j] = -1;
+	}
+	strandRunCnt = 0;
+
+	std::vector<std::thread> producers;
+	for (int p = 0; p < STRAND_PRODUCERS; p++)
+		producers.push_back(std::thread([p, &strands]() {
+			for (int seq = 0; seq < STRAND_MSGS; seq++)
+				for (int i = 0; i < STRANDS; i++)
+					MakeDelegate(&StrandFunc, strands[i])(i, p, seq);
+		}));
+	for (size_t i = 0; i < producers.size(); i++)
+		producers[i].join();
+
+	// Exiting the pool runs every pending strand message first
+	pool.ExitThreads();
+	ASSERT_TRUE(strandRunCnt.load() == STRANDS * STRAND_PRODUCERS * STRAND_MSGS);
+	for (int i = 0; i < STRANDS; i++)
+	{
+		ASSERT_TRUE(!strands[i]->IsBusy());
+		for (int j = 0; j < STRAND_PRODUCERS; j++)
+			ASSERT_TRUE(strandLastSeq[i][j] == STRAND_MSGS - 1);
+		delete strands[i];
+	}
+}
+
+/// An executor that holds dispatched messages until Run() and rejects the 
+/// next dispatch when asked. A rejected dispatch first calls onReject, which 
+/// stands in for another thread queuing on the strand at the same time.
+class StrandTestExecutor : public DelegateThread
+{
+public:
+	StrandTestExecutor() : rejectCnt(0), onReject(0) { }
+
+	virtual bool DispatchDelegate(DelegateMsgBase* msg) {
+		if (rejectCnt > 0) {
+			rejectCnt--;
+			if (onReject)
+				onReject();
+			DiscardMsg(msg);
+			return false;
+		}
+		queue.push_back(msg);
+		return true;
+	}
+
+	void Run() {
+		while (!queue.empty()) {
+			DelegateMsgBase* msg = queue.front();
+			queue.erase(queue.begin());
+			msg->GetDelegateInvoker()->DelegateInvoke(&msg);
+		}
+	}
+
+	int rejectCnt;
+	void (*onReject)();
+	std::vector<DelegateMsgBase*> queue;
+};
+
+static std::vector<int> strandRejectLog;
+static DelegateFreeAsync1<int>* strandRejectLate = 0;
+
+static void StrandRejectRecord(int value) { strandRejectLog.push_back(value); }
+static void StrandRejectQueueLate() { (*strandRejectLate)(2); }
+
+// Only the message whose dispatch the executor rejects is discarded
+void DelegateStrandRejectTests()
+{
+	StrandTestExecutor executor;
+	DelegateStrand strand(&executor);
+	DelegateFreeAsync1<int> first = MakeDelegate(&StrandRejectRecord, &strand);
+	DelegateFreeAsync1<int> late = MakeDelegate(&StrandRejectRecord, &strand);
+	strandRejectLate = &late;
+	strandRejectLog.clear();
+
+	// A message queued while the strand is being scheduled still runs
+	executor.rejectCnt = 1;
+	executor.onReject = &StrandRejectQueueLate;
+	first(1);
+	ASSERT_TRUE(!first.IsDispatched());
+	ASSERT_TRUE(late.IsDispatched());
+	ASSERT_TRUE(strand.IsBusy());
+	executor.Run();
+	ASSERT_TRUE(strandRejectLog.size() == 1 && strandRejectLog[0] == 2);
+	ASSERT_TRUE(!strand.IsBusy());
+
+	// A rejected dispatch on its own leaves the strand idle and usable
+	executor.rejectCnt = 1;
+	executor.onReject = 0;
+	first(3);
+	ASSERT_TRUE(!first.IsDispatched());
+	ASSERT_TRUE(!strand.IsBusy());
+	first(4);
+	ASSERT_TRUE(first.IsDispatched());
+	executor.Run();
+	ASSERT_TRUE(strandRejectLog.size() == 2 && strandRejectLog[1] == 4);
+
+	// If scheduling again is rejected too, the queued messages are discarded
+	executor.rejectCnt = 2;
+	executor.onReject = &StrandRejectQueueLate;
+	first(5);
+	ASSERT_TRUE(!first.IsDispatched());
+	ASSERT_TRUE(!strand.IsBusy());
+	executor.Run();
+	ASSERT_TRUE(strandRejectLog.size() == 2);
+	strandRejectLate = 0;
+}
+
+static const int XALLOC_THREADS = 4;
+static const int XALLOC_BLOCKS = 500;
+
+/// Fill a block with a pattern unique to the block so overlapping blocks are detected
+static void XallocFill(void* block, size_t size, int id)
+{
+	memset(block, id & 0xff, size);
+}
+
+static bool XallocCheck(void* block, size_t size, int id)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(block);
+	for (size_t i = 0; i < size; i++)
+		if (bytes[i] != (id & 0xff))
+			return false;
+	return true;
+}
+
+static size_t XallocSize(int i)
+{
+	// Mostly cached sizes, with some too large for the thread caches
+	return (i % 50 == 0) ? 6000 : (size_t)(1 + (i * 37) % 700);
+}
+
+extern "C" Allocator* xallocator_get_allocator(size_t size);
+
+struct XfreeDeleter
+{
+	void operator()(char* block) const { xfree(block); }
+};
+typedef std::unique_ptr<char, XfreeDeleter> XallocPtr;
+
+static const int XALLOC_PIPE_SIZE = 100;
+static const int XALLOC_PIPE_BLOCKS = 20000;
+static std::atomic<int> xallocPipeInFlight(0);
+
+// Called on the consumer thread. The block was allocated on the producer thread.
+void XallocPipeConsume(XallocPtr block, int id)
+{
+	ASSERT_TRUE(XallocCheck(block.get(), XALLOC_PIPE_SIZE, id));
+	block.reset();
+	xallocPipeInFlight--;
+}
+
+/// Allocate on a producer thread and free on a consumer thread. Freed blocks go
+/// back to the producer's cache, so the shared allocator barely grows.
+static void XallocPipelineTests()
+{
+	const int IN_FLIGHT = 64;
+	WorkerThread consumer("XallocConsumer");
+	consumer.CreateThread();
+	Allocator* allocator = xallocator_get_allocator(XALLOC_PIPE_SIZE);
+	UINT blockCnt = allocator->GetBlockCount();
+
+	std::thread producer([&consumer]() {
+		DelegateFreeAsync2<XallocPtr, int> delegate = MakeDelegate(&XallocPipeConsume, &consumer);
+		for (int i = 0; i < XALLOC_PIPE_BLOCKS; i++) {
+			while (xallocPipeInFlight.load() >= IN_FLIGHT)
+				std::this_thread::yield();
+			xallocPipeInFlight++;
+
+			XallocPtr block(static_cast<char*>(xmalloc(XALLOC_PIPE_SIZE)));
+			XallocFill(block.get(), XALLOC_PIPE_SIZE, i);
+			delegate(std::move(block), i);
+		}
+	});
+	producer.join();
+
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &consumer, WAIT_INFINITE);
+	flush();
+	ASSERT_TRUE(flush.IsSuccess());
+	consumer.ExitThread();
+
+	ASSERT_TRUE(xallocPipeInFlight.load() == 0);
+	ASSERT_TRUE(allocator->GetBlockCount() - blockCnt <= 16 * IN_FLIGHT);
+}
+
+/// Allocate and free on each thread, and free blocks allocated by another thread
+void XallocatorTests()
+{
+	// Two size classes per power of two. A block holds the size requested plus
+	// the allocator pointer and wastes less than a third of itself.
+	ASSERT_TRUE(xallocator_get_allocator(1)->GetBlockSize() == 16);
+	ASSERT_TRUE(xallocator_get_allocator(40 - sizeof(Allocator*))->GetBlockSize() == 48);
+	ASSERT_TRUE(xallocator_get_allocator(49 - sizeof(Allocator*))->GetBlockSize() == 64);
+	ASSERT_TRUE(xallocator_get_allocator(96 - sizeof(Allocator*))->GetBlockSize() == 96);
+	ASSERT_TRUE(xallocator_get_allocator(192 - sizeof(Allocator*))->GetBlockSize() == 192);
+	for (size_t size = 1; size < 70000; size += 1 + size / 16)
+	{
+		size_t blockSize = xallocator_get_allocator(size)->GetBlockSize();
+		ASSERT_TRUE(blockSize >= size + sizeof(Allocator*));
+		ASSERT_TRUE(blockSize <= 16 || (blockSize - size - sizeof(Allocator*)) * 3 < blockSize);
+		ASSERT_TRUE(xallocator_get_allocator(size) == xallocator_get_allocator(blockSize - sizeof(Allocator*)));
+	}
+
+	std::vector<std::vector<void*> > handoff(XALLOC_THREADS);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < XALLOC_THREADS; t++)
+		threads.push_back(std::thread([t, &handoff]() {
+			std::vector<void*> blocks;
+			for (int pass = 0; pass < 4; pass++) {
+				for (int i = 0; i < XALLOC_BLOCKS; i++) {
+					blocks.push_back(xmalloc(XallocSize(i)));
+					XallocFill(blocks[i], XallocSize(i), t * XALLOC_BLOCKS + i);
+				}
+				for (int i = 0; i < XALLOC_BLOCKS; i++) {
+					ASSERT_TRUE(XallocCheck(blocks[i], XallocSize(i), t * XALLOC_BLOCKS + i));
+					xfree(blocks[i]);
+				}
+				blocks.clear();
+			}
+
+			// Leave a set of blocks for another thread to free
+			for (int i = 0; i < XALLOC_BLOCKS; i++) {
+				handoff[t].push_back(xmalloc(XallocSize(i)));
+				XallocFill(handoff[t][i], XallocSize(i), t + i);
+			}
+		}));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+	threads.clear();
+
+	for (int t = 0; t < XALLOC_THREADS; t++)
+		threads.push_back(std::thread([t, &handoff]() {
+			std::vector<void*>& blocks = handoff[(t + 1) % XALLOC_THREADS];
+			for (int i = 0; i < XALLOC_BLOCKS; i++) {
+				ASSERT_TRUE(XallocCheck(blocks[i], XallocSize(i), (t + 1) % XALLOC_THREADS + i));
+				xfree(blocks[i]);
+			}
+		}));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+
+	XallocPipelineTests();
+
+	// xrealloc keeps the contents
+	void* block = xmalloc(20);
+	XallocFill(block, 20, 7);
+	block = xrealloc(block, 3000);
+	ASSERT_TRUE(XallocCheck(block, 20, 7));
+	xfree(block);
+}
+
+static const int LOCK_FREE_PRODUCERS = 4;
+static const int LOCK_FREE_MSGS = 5000;
+static const int LOCK_FREE_IN_FLIGHT = 24;
+static const int LOCK_FREE_POOL = 128;
+
+/// A message allocated on producer threads and deleted on the consumer thread
+class LockFreeAllocMsg
+{
+	DECLARE_ALLOCATOR
+public:
+	int producer;
+	int seq;
+	char pattern[40];
+};
+IMPLEMENT_LOCK_FREE_ALLOCATOR(LockFreeAllocMsg, LOCK_FREE_POOL, NULL)
+
+static std::atomic<int> lockFreeInFlight[LOCK_FREE_PRODUCERS];
+static int lockFreeLastSeq[LOCK_FREE_PRODUCERS];
+
+// Called on the consumer thread only
+void LockFreeAllocConsume(std::unique_ptr<LockFreeAllocMsg> msg)
+{
+	int producer = msg->producer;
+	ASSERT_TRUE(msg->seq == lockFreeLastSeq[producer] + 1);
+	ASSERT_TRUE(XallocCheck(msg->pattern, sizeof(msg->pattern), producer * LOCK_FREE_MSGS + msg->seq));
+	lockFreeLastSeq[producer] = msg->seq;
+	msg.reset();
+	lockFreeInFlight[producer]--;
+}
+
+/// Producers and a consumer share a lock-free pool, and threads allocate and 
+/// free from a shared lock-free allocator directly
+void AllocatorLockFreeTests()
+{
+	WorkerThread consumer("LockFreeAllocConsumer");
+	consumer.CreateThread();
+	for (int i = 0; i < LOCK_FREE_PRODUCERS; i++)
+	{
+		lockFreeInFlight[i] = 0;
+		lockFreeLastSeq[i] = -1;
+	}
+
+	std::vector<std::thread> threads;
+	for (int p = 0; p < LOCK_FREE_PRODUCERS; p++)
+		threads.push_back(std::thread([p, &consumer]() {
+			DelegateFreeAsync1<std::unique_ptr<LockFreeAllocMsg> > delegate = MakeDelegate(&LockFreeAllocConsume, &consumer);
+			for (int seq = 0; seq < LOCK_FREE_MSGS; seq++) {
+				// Bound the messages in flight so the pool is never exhausted
+				while (lockFreeInFlight[p].load() >= LOCK_FREE_IN_FLIGHT)
+					std::this_thread::yield();
+				lockFreeInFlight[p]++;
+
+				std::unique_ptr<LockFreeAllocMsg> msg(new LockFreeAllocMsg);
+				msg->producer = p;
+				msg->seq = seq;
+				XallocFill(msg->pattern, sizeof(msg->pattern), p * LOCK_FREE_MSGS + seq);
+				delegate(std::move(msg));
+			}
+		}));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+	threads.clear();
+
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &consumer, WAIT_INFINITE);
+	flush();
+	ASSERT_TRUE(flush.IsSuccess());
+	consumer.ExitThread();
+	for (int i = 0; i < LOCK_FREE_PRODUCERS; i++)
+		ASSERT_TRUE(lockFreeLastSeq[i] == LOCK_FREE_MSGS - 1);
+
+	// Every thread holds a few blocks at a time, so blocks move between threads
+	Allocator allocator(sizeof(int) * 4, LOCK_FREE_POOL, NULL, "LockFreeTest", TRUE);
+	ASSERT_TRUE(allocator.IsLockFree());
+	for (int t = 0; t < LOCK_FREE_PRODUCERS; t++)
+		threads.push_back(std::thread([t, &allocator]() {
+			const int HELD = 8;
+			void* blocks[HELD];
+			for (int i = 0; i < LOCK_FREE_MSGS; i++) {
+				for (int b = 0; b < HELD; b++) {
+					blocks[b] = allocator.Allocate(sizeof(int) * 4);
+					XallocFill(blocks[b], sizeof(int) * 4, t * HELD + b);
+				}
+				for (int b = 0; b < HELD; b++) {
+					ASSERT_TRUE(XallocCheck(blocks[b], sizeof(int) * 4, t * HELD + b));
+					allocator.Deallocate(blocks[b]);
+				}
+			}
+		}));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+
+	ASSERT_TRUE(allocator.GetBlocksInUse() == 0);
+	ASSERT_TRUE(allocator.GetAllocations() == (UINT)(LOCK_FREE_PRODUCERS * LOCK_FREE_MSGS * 8));
+	ASSERT_TRUE(allocator.GetDeallocations() == allocator.GetAllocations());
+
+	// The whole pool can be allocated, in distinct blocks, and returned
+	std::set<void*> all;
+	for (int i = 0; i < LOCK_FREE_POOL; i++)
+		all.insert(allocator.Allocate(sizeof(int)));
+	ASSERT_TRUE(all.size() == LOCK_FREE_POOL);
+	for (std::set<void*>::iterator it = all.begin(); it != all.end(); ++it)
+		allocator.Deallocate(*it);
+	ASSERT_TRUE(allocator.GetBlocksInUse() == 0);
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Variadic delegates
+//------------------------------------------------------------------------------
+static INT variadicSum = 0;
+
+INT VariadicSum7(INT a, INT b, INT c, INT d, INT e, INT f, INT g) { return a + b + c + d + e + f + g; }
+void VariadicStore7(INT a, INT b, INT c, INT d, INT e, INT f, INT g) { variadicSum = a + b + c + d + e + f + g; }
+void VariadicOut6(INT& out, INT a, INT b, INT c, INT d, INT e) { out = a + b + c + d + e; }
+
+class TestClassVariadic
+{
+public:
+	TestClassVariadic() : sum(0) { }
+	INT Sum7(INT a, INT b, INT c, INT d, INT e, INT f, INT g) { return a + b + c + d + e + f + g; }
+	INT Sum7Const(INT a, INT b, INT c, INT d, INT e, INT f, INT g) const { return a + b + c + d + e + f + g; }
+	void Store7(INT a, INT b, INT c, INT d, INT e, INT f, INT g) { sum = a + b + c + d + e + f + g; }
+	INT sum;
+};
+
+void VariadicDelegateTests()
+{
+	typedef INT Sum7Sig(INT, INT, INT, INT, INT, INT, INT);
+	typedef void Store7Sig(INT, INT, INT, INT, INT, INT, INT);
+	const INT SUM = 28;
+	TestClassVariadic testClass;
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &testThread, WAIT_INFINITE);
+
+	// Synchronous delegates beyond the five arguments of the numbered classes
+	DelegateFree<Sum7Sig> freeDelegate = MakeDelegate(&VariadicSum7);
+	ASSERT_TRUE(freeDelegate(1, 2, 3, 4, 5, 6, 7) == SUM);
+
+	DelegateMember<TestClassVariadic, Sum7Sig> memberDelegate = MakeDelegate(&testClass, &TestClassVariadic::Sum7);
+	Delegate<Sum7Sig>& baseDelegate = memberDelegate;
+	ASSERT_TRUE(baseDelegate(1, 2, 3, 4, 5, 6, 7) == SUM);
+	ASSERT_TRUE(MakeDelegate(&testClass, &TestClassVariadic::Sum7Const)(1, 2, 3, 4, 5, 6, 7) == SUM);
+	ASSERT_TRUE(!(freeDelegate == memberDelegate));
+
+	SinglecastDelegate<Sum7Sig> singlecast;
+	ASSERT_TRUE(!singlecast);
+	singlecast = freeDelegate;
+	ASSERT_TRUE(singlecast(1, 2, 3, 4, 5, 6, 7) == SUM);
+
+	// Asynchronous delegates
+	MulticastDelegateSafe<Store7Sig> multicast;
+	multicast += MakeDelegate(&VariadicStore7, &testThread);
+	multicast += MakeDelegate(&testClass, &TestClassVariadic::Store7, &testThread);
+	variadicSum = 0;
+	multicast(1, 2, 3, 4, 5, 6, 7);
+	flush();
+	ASSERT_TRUE(variadicSum == SUM);
+	ASSERT_TRUE(testClass.sum == SUM);
+	multicast -= MakeDelegate(&VariadicStore7, &testThread);
+	multicast -= MakeDelegate(&testClass, &TestClassVariadic::Store7, &testThread);
+	ASSERT_TRUE(multicast.Empty());
+
+	DelegateFreeAsyncWait<Sum7Sig> freeWait = MakeDelegate(&VariadicSum7, &testThread, WAIT_INFINITE);
+	ASSERT_TRUE(freeWait(1, 2, 3, 4, 5, 6, 7) == SUM);
+	ASSERT_TRUE(freeWait.IsSuccess() && freeWait.GetRetVal() == SUM);
+
+	DelegateMemberAsyncWait<TestClassVariadic, Sum7Sig> memberWait = 
+		MakeDelegate(&testClass, &TestClassVariadic::Sum7, &testThread, WAIT_INFINITE);
+	ASSERT_TRUE(memberWait(1, 2, 3, 4, 5, 6, 7) == SUM);
+	ASSERT_TRUE(memberWait.IsSuccess());
+
+	// A blocking call passes reference arguments through to the target
+	INT out = 0;
+	DelegateFreeAsyncWait<void(INT&, INT, INT, INT, INT, INT)> outWait = MakeDelegate(&VariadicOut6, &testThread, WAIT_INFINITE);
+	outWait(out, 1, 2, 3, 4, 5);
+	ASSERT_TRUE(outWait.IsSuccess() && out == 15);
+
+	std::shared_ptr<TestClassVariadic> testClassSp(new TestClassVariadic());
+	DelegateMemberSpAsync<TestClassVariadic, Store7Sig> spAsync = MakeDelegate(testClassSp, &TestClassVariadic::Store7, &testThread);
+	spAsync(1, 2, 3, 4, 5, 6, 7);
+	flush();
+	ASSERT_TRUE(testClassSp->sum == SUM);
+
+	// The numbered names are aliases of the variadic classes
+	static_assert(std::is_same<Delegate2<INT, INT, INT>, Delegate<INT(INT, INT)> >::value, "Delegate2 alias");
+	static_assert(std::is_same<DelegateFree0<>, DelegateFree<void()> >::value, "DelegateFree0 alias");
+	static_assert(std::is_same<DelegateFreeAsync0, DelegateFreeAsync<void()> >::value, "DelegateFreeAsync0 alias");
+	static_assert(std::is_same<MulticastDelegateSafe1<INT>, MulticastDelegateSafe<void(INT)> >::value, "MulticastDelegateSafe1 alias");
+}
+
+//------------------------------------------------------------------------------
+// Remote delegates
+//------------------------------------------------------------------------------
+/// Loops the remote message straight back to the receiving delegates
+class LoopbackTransport : public IDelegateTransport
+{
+public:
+	virtual void DispatchDelegate(std::iostream& s) {
+		ASSERT_TRUE(DelegateRemoteInvoker::Invoke(s));
+	}
+};
+
+static const DelegateIdType REMOTE_FREE_ID = 1;
+static const DelegateIdType REMOTE_MEMBER_ID = 2;
+static INT remoteInt = 0;
+static float remoteFloat = 0;
+
+void RemoteFunc(INT i, float f, char c) { remoteInt = i; remoteFloat = f; ASSERT_TRUE(c == 'x'); }
+
+class TestClassRemote
+{
+public:
+	TestClassRemote() : sum(0) { }
+	void Sum6(INT& a, INT b, INT c, INT d, INT e, INT f) { sum = a + b + c + d + e + f; }
+	INT sum;
+};
+
+void DelegateRemoteTests()
+{
+	LoopbackTransport transport;
+	TestClassRemote testClass;
+
+	DelegateFreeRemoteRecv<void(INT, float, char)> freeRecv(&RemoteFunc, REMOTE_FREE_ID);
+	DelegateMemberRemoteRecv<TestClassRemote, void(INT&, INT, INT, INT, INT, INT)> memberRecv(
+		&testClass, &TestClassRemote::Sum6, REMOTE_MEMBER_ID);
+
+	std::stringstream freeStream;
+	DelegateRemoteSend3<INT, float, char> freeSend(transport, freeStream, REMOTE_FREE_ID);
+	freeSend(TEST_INT, 1.5f, 'x');
+	ASSERT_TRUE(remoteInt == TEST_INT && remoteFloat == 1.5f);
+
+	std::stringstream memberStream;
+	DelegateRemoteSend<void(INT&, INT, INT, INT, INT, INT)> memberSend = 
+		MakeDelegate<INT&, INT, INT, INT, INT, INT>(transport, memberStream, REMOTE_MEMBER_ID);
+	INT first = 1;
+	memberSend(first, 2, 3, 4, 5, 6);
+	ASSERT_TRUE(testClass.sum == 21);
+}
+
+/// Counts live copies so the tests can check a message destroys its argument copies
+template <size_t SIZE>
+struct CountedArg
+{
+	CountedArg() : val(TEST_INT) { liveCnt++; }
+	CountedArg(const CountedArg& rhs) : val(rhs.val) { liveCnt++; }
+	~CountedArg() { liveCnt--; }
+	INT val;
+	char pad[SIZE];
+	static std::atomic<int> liveCnt;
+};
+template <size_t SIZE> std::atomic<int> CountedArg<SIZE>::liveCnt(0);
+
+typedef CountedArg<8> SmallArg;
+typedef CountedArg<DELEGATE_INLINE_ARG_SIZE> LargeArg;
+
+void SmallArgPtr(SmallArg* a) { ASSERT_TRUE(a->val == TEST_INT); }
+void SmallArgConstRef(const SmallArg& a, INT i) { ASSERT_TRUE(a.val == TEST_INT && i == TEST_INT); }
+void SmallArgThree(SmallArg* a, const SmallArg& b, INT i) { ASSERT_TRUE(a->val == TEST_INT && b.val == TEST_INT); }
+void LargeArgPtr(LargeArg* a) { ASSERT_TRUE(a->val == TEST_INT); }
+
+template <class Call>
+static int AllocsPerCall(DelegateFreeAsyncWait0<void>& flush, Call call)
+{
+	const int LOOP_CNT = 100;
+	StartAllocCount();
+	for (int i = 0; i < LOOP_CNT; i++)
+		call();
+	int cnt = StopAllocCount();
+	flush();
+	ASSERT_TRUE(cnt % LOOP_CNT == 0);
+	return cnt / LOOP_CNT;
+}
+
+void AllocCountThread(WorkerThread& thread)
+{
+	const int LOOP_CNT = 100;
+	DelegateFreeAsync1<INT> delegate = MakeDelegate(&FreeFuncInt1, &thread);
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+
+	// Warm up any lazily created state
+	delegate(TEST_INT);
+	flush();
+
+	StartAllocCount();
+	for (int i = 0; i < LOOP_CNT; i++)
+		delegate(TEST_INT);
+	int cnt = StopAllocCount();
+	flush();
+
+	// One message per call. The message holds the delegate and is the queue node 
+	// so DispatchDelegate() adds nothing. 
+	ASSERT_TRUE(cnt == LOOP_CNT);
+
+	// A blocking call also allocates only the message, which holds the wait state
+	ASSERT_TRUE(AllocsPerCall(flush, [&]() { flush(); }) == 1);
+}
+
+void AllocCountArgs(WorkerThread& thread)
+{
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+	SmallArg small;
+	LargeArg large;
+
+	// Small pointer and reference arguments are copied into the message, so 
+	// a call costs only the message whatever the arguments
+	DelegateFreeAsync1<SmallArg*> ptr = MakeDelegate(&SmallArgPtr, &thread);
+	ASSERT_TRUE(AllocsPerCall(flush, [&]() { ptr(&small); }) == 1);
+
+	DelegateFreeAsync2<const SmallArg&, INT> ref = MakeDelegate(&SmallArgConstRef, &thread);
+	ASSERT_TRUE(AllocsPerCall(flush, [&]() { ref(small, TEST_INT); }) == 1);
+
+	DelegateFreeAsync3<SmallArg*, const SmallArg&, INT> three = MakeDelegate(&SmallArgThree, &thread);
+	ASSERT_TRUE(AllocsPerCall(flush, [&]() { three(&small, small, TEST_INT); }) == 1);
+
+	// Larger arguments fall back to a heap copy
+	DelegateFreeAsync1<LargeArg*> largePtr = MakeDelegate(&LargeArgPtr, &thread);
+	ASSERT_TRUE(AllocsPerCall(flush, [&]() { largePtr(&large); }) == 2);
+
+	// Every copy is destroyed with its message
+	ASSERT_TRUE(SmallArg::liveCnt.load() == 1);
+	ASSERT_TRUE(LargeArg::liveCnt.load() == 1);
+}
+
+static const char* moveData = 0;
+
+void MoveVector(std::vector<char> v) { moveData = v.data(); }
+void MoveVectorRvalueRef(std::vector<char>&& v) { std::vector<char> taken(std::move(v)); moveData = taken.data(); }
+void MoveUniquePtr(std::unique_ptr<INT> p) { ASSERT_TRUE(p && *p == TEST_INT); }
+INT MoveUniquePtrRet(std::unique_ptr<INT> p) { return *p; }
+
+class TestClassMove
+{
+public:
+	void MoveVector(std::vector<char> v) { moveData = v.data(); }
+};
+
+/// Invoke a delegate with a 1 MB vector rvalue and check it was moved, not 
+/// copied, all the way to the target function
+template <class TDelegate>
+static void MoveVectorCheck(DelegateFreeAsyncWait0<void>& flush, TDelegate& delegate)
+{
+	std::vector<char> vec(1024 * 1024);
+	const char* data = vec.data();
+	moveData = 0;
+
+	StartAllocCount();
+	delegate(std::move(vec));
+	int cnt = StopAllocCount();
+	flush();
+
+	// The message is the only allocation and the target gets the caller's buffer
+	ASSERT_TRUE(cnt == 1);
+	ASSERT_TRUE(moveData == data);
+}
+
+void AllocCountMove(WorkerThread& thread)
+{
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+	TestClassMove testClass;
+	std::shared_ptr<TestClassMove> testClassSp(new TestClassMove());
+
+	DelegateFreeAsync1<std::vector<char> > freeAsync = MakeDelegate(&MoveVector, &thread);
+	MoveVectorCheck(flush, freeAsync);
+
+	DelegateMemberAsync1<TestClassMove, std::vector<char> > memberAsync = 
+		MakeDelegate(&testClass, &TestClassMove::MoveVector, &thread);
+	MoveVectorCheck(flush, memberAsync);
+
+	DelegateMemberSpAsync1<TestClassMove, std::vector<char> > spAsync = 
+		MakeDelegate(testClassSp, &TestClassMove::MoveVector, &thread);
+	MoveVectorCheck(flush, spAsync);
+
+	DelegateFreeAsync1<std::vector<char>&&> rvalueRefAsync = MakeDelegate(&MoveVectorRvalueRef, &thread);
+	MoveVectorCheck(flush, rvalueRefAsync);
+
+	DelegateFreeAsyncWait1<std::vector<char> > freeWait = MakeDelegate(&MoveVector, &thread, WAIT_INFINITE);
+	MoveVectorCheck(flush, freeWait);
+	ASSERT_TRUE(freeWait.IsSuccess());
+
+	DelegateFreeAsyncWait1<std::vector<char>&&> rvalueRefWait = MakeDelegate(&MoveVectorRvalueRef, &thread, WAIT_INFINITE);
+	MoveVectorCheck(flush, rvalueRefWait);
+
+	// Move-only arguments
+	DelegateFreeAsync1<std::unique_ptr<INT> > uniqueAsync = MakeDelegate(&MoveUniquePtr, &thread);
+	uniqueAsync(std::unique_ptr<INT>(new INT(TEST_INT)));
+	flush();
+
+	DelegateFreeAsyncWait1<std::unique_ptr<INT>, INT> uniqueWait = MakeDelegate(&MoveUniquePtrRet, &thread, WAIT_INFINITE);
+	ASSERT_TRUE(uniqueWait(std::unique_ptr<INT>(new INT(TEST_INT))) == TEST_INT);
+
+	SinglecastDelegate1<std::unique_ptr<INT> > uniqueSinglecast;
+	uniqueSinglecast = uniqueAsync;
+	uniqueSinglecast(std::unique_ptr<INT>(new INT(TEST_INT)));
+	flush();
+}
+
+/// A small argument type with its own DelegateParam<> copies, which are used
+/// in place of copying the argument into the message
+struct UserCopyArg { INT val; };
+static std::atomic<int> userCopyPtrCnt(0);
+static std::atomic<int> userCopyRefCnt(0);
+
+namespace DelegateLib {
+template <>
+class DelegateParam<UserCopyArg*>
+{
+public:
+	static UserCopyArg* New(UserCopyArg* param) { userCopyPtrCnt++; return new UserCopyArg(*param); }
+	static void Delete(UserCopyArg* param) { userCopyPtrCnt--; delete param; }
+};
+
+template <>
+class DelegateParam<UserCopyArg&>
+{
+public:
+	static UserCopyArg& New(UserCopyArg& param) { userCopyRefCnt++; return *new UserCopyArg(param); }
+	static void Delete(UserCopyArg& param) { userCopyRefCnt--; delete &param; }
+};
+}
+
+// The target is invoked with the copy made by the argument type's DelegateParam<>
+void UserCopyArgPtr(UserCopyArg* a) { ASSERT_TRUE(a->val == TEST_INT && userCopyPtrCnt.load() == 1 && userCopyRefCnt.load() == 0); }
+void UserCopyArgRef(UserCopyArg& a) { ASSERT_TRUE(a.val == TEST_INT && userCopyPtrCnt.load() == 0 && userCopyRefCnt.load() == 1); }
+
+void DelegateParamTests(WorkerThread& thread)
+{
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+	UserCopyArg arg;
+	arg.val = TEST_INT;
+
+	// A pointer argument is copied with DelegateParam<UserCopyArg*> and a 
+	// reference argument with DelegateParam<UserCopyArg&>. Each copy is 
+	// deleted with its message.
+	DelegateFreeAsync1<UserCopyArg*> ptr = MakeDelegate(&UserCopyArgPtr, &thread);
+	ptr(&arg);
+	flush();
+	ASSERT_TRUE(userCopyPtrCnt.load() == 0);
+
+	DelegateFreeAsync1<UserCopyArg&> ref = MakeDelegate(&UserCopyArgRef, &thread);
+	ref(arg);
+	flush();
+	ASSERT_TRUE(userCopyRefCnt.load() == 0);
+}
+
+static const INT BUFFER_SUBSCRIBERS = 4;
+
+class TestClassBuffer
+{
+public:
+	TestClassBuffer() : data(0), size(0) { }
+	void BufferRef(const DelegateBuffer& b) { data = b.Data(); size = b.Size(); }
+	void BufferPtr(const DelegateBuffer* b) { data = b->Data(); size = b->Size(); }
+	void BufferValue(DelegateBuffer b) { data = b.Data(); size = b.Size(); }
+	const char* data;
+	size_t size;
+};
+
+void DelegateBufferTests(WorkerThread& thread)
+{
+	const size_t SIZE = 4 * 1024 * 1024;
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+
+	DelegateBuffer empty;
+	ASSERT_TRUE(empty.Empty() && empty.Size() == 0 && empty.Data() == 0 && empty.UseCount() == 0);
+
+	const char bytes[] = "DelegateBuffer";
+	DelegateBuffer small(bytes, sizeof(bytes));
+	ASSERT_TRUE(small.Size() == sizeof(bytes) && memcmp(small.Data(), bytes, sizeof(bytes)) == 0);
+	{
+		DelegateBuffer copy(small);
+		ASSERT_TRUE(copy.Data() == small.Data() && small.UseCount() == 2);
+		DelegateBuffer moved(std::move(copy));
+		ASSERT_TRUE(copy.Empty() && small.UseCount() == 2);
+		empty = moved;
+		ASSERT_TRUE(small.UseCount() == 3);
+	}
+	empty = DelegateBuffer();
+	ASSERT_TRUE(small.UseCount() == 1);
+
+	DelegateBuffer buffer(SIZE, [](char* data, size_t size) { memset(data, 0x5a, size); });
+	ASSERT_TRUE(buffer.Size() == SIZE && buffer.Data()[SIZE - 1] == 0x5a);
+
+	// Multicast one buffer to several asynchronous subscribers, passed by 
+	// reference, pointer and value. Each call only allocates the messages; the 
+	// subscribers all see the original bytes.
+	TestClassBuffer subscribers[BUFFER_SUBSCRIBERS];
+	MulticastDelegateSafe1<const DelegateBuffer&> refMulticast;
+	MulticastDelegateSafe1<const DelegateBuffer*> ptrMulticast;
+	MulticastDelegateSafe1<DelegateBuffer> valueMulticast;
+	for (INT i = 0; i < BUFFER_SUBSCRIBERS; i++) {
+		refMulticast += MakeDelegate(&subscribers[i], &TestClassBuffer::BufferRef, &thread);
+		ptrMulticast += MakeDelegate(&subscribers[i], &TestClassBuffer::BufferPtr, &thread);
+		valueMulticast += MakeDelegate(&subscribers[i], &TestClassBuffer::BufferValue, &thread);
+	}
+
+	for (int pass = 0; pass < 3; pass++) {
+		for (INT i = 0; i < BUFFER_SUBSCRIBERS; i++)
+			subscribers[i].data = 0;
+
+		StartAllocCount();
+		if (pass == 0)
+			refMulticast(buffer);
+		else if (pass == 1)
+			ptrMulticast(&buffer);
+		else
+			valueMulticast(buffer);
+		int cnt = StopAllocCount();
+		flush();
+
+#if USE_DELEGATE_POOLS
+		// Messages come from pools, which are created on first use
+		ASSERT_TRUE(cnt <= BUFFER_SUBSCRIBERS);
+#elif DELEGATE_ALLOC_COUNT_TESTS && !USE_XALLOCATOR
+		ASSERT_TRUE(cnt == BUFFER_SUBSCRIBERS);
+#endif
+		for (INT i = 0; i < BUFFER_SUBSCRIBERS; i++)
+			ASSERT_TRUE(subscribers[i].data == buffer.Data() && subscribers[i].size == SIZE);
+
+		// Every message released its reference
+		ASSERT_TRUE(buffer.UseCount() == 1);
+	}
+}
+
+/// Records the order a thread's subscribers are called in and the argument 
+/// each receives. The log is only written on the subscriber's thread.
+class CoalesceSubscriber
+{
+public:
+	void Record(const StructParam* param, int value) { 
+		log->push_back(id); 
+		lastParam = param; 
+		lastParamVal = param->val;
+		lastValue = value;
+	}
+
+	int id;
+	std::vector<int>* log;
+	const StructParam* lastParam;
+	int lastParamVal;
+	int lastValue;
+};
+
+void DelegateCoalesceTests(WorkerThread& thread)
+{
+	static const int SUBSCRIBERS = 8;
+	WorkerThread otherThread("DelegateCoalesceThread");
+	otherThread.CreateThread();
+	WorkerThread* threads[] = { &thread, &otherThread };
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+	DelegateFreeAsyncWait0<void> flushOther = MakeDelegate(&FreeFunc0, &otherThread, WAIT_INFINITE);
+
+	// Subscribers alternate between the two threads, plus one synchronous one
+	std::vector<int> logs[2], syncLog;
+	syncLog.reserve(3);
+	CoalesceSubscriber subscribers[SUBSCRIBERS + 1];
+	DelegateConnection connections[SUBSCRIBERS];
+	MulticastDelegateSafe<void(const StructParam*, int)> multicast;
+	ASSERT_TRUE(!multicast.GetCoalesce());
+	multicast.SetCoalesce(true);
+	ASSERT_TRUE(multicast.GetCoalesce());
+	for (int i = 0; i <= SUBSCRIBERS; i++) {
+		subscribers[i].id = i;
+		subscribers[i].log = i < SUBSCRIBERS ? &logs[i % 2] : &syncLog;
+		subscribers[i].lastParam = 0;
+		if (i < SUBSCRIBERS)
+			connections[i] = multicast += MakeDelegate(&subscribers[i], &CoalesceSubscriber::Record, threads[i % 2]);
+		else
+			multicast += MakeDelegate(&subscribers[i], &CoalesceSubscriber::Record);
+	}
+
+	// One message per thread, each calling its subscribers in order with one 
+	// shared copy of the pointer argument
+	StructParam param;
+	param.val = TEST_INT;
+	StartAllocCount();
+	multicast(&param, TEST_INT);
+	int cnt = StopAllocCount();
+	flush();
+	flushOther();
+#if DELEGATE_ALLOC_COUNT_TESTS && !USE_DELEGATE_POOLS && !USE_XALLOCATOR
+	ASSERT_TRUE(cnt == 2);
+#endif
+	ASSERT_TRUE(syncLog.size() == 1 && subscribers[SUBSCRIBERS].lastParam == &param);
+	for (int t = 0; t < 2; t++) {
+		ASSERT_TRUE(logs[t].size() == SUBSCRIBERS / 2);
+		for (int i = 0; i < SUBSCRIBERS / 2; i++) {
+			ASSERT_TRUE(logs[t][i] == i * 2 + t);
+			ASSERT_TRUE(subscribers[i * 2 + t].lastParam == subscribers[t].lastParam);
+			ASSERT_TRUE(subscribers[i * 2 + t].lastParamVal == TEST_INT);
+			ASSERT_TRUE(subscribers[i * 2 + t].lastValue == TEST_INT);
+		}
+		ASSERT_TRUE(subscribers[t].lastParam != &param);
+		logs[t].clear();
+	}
+
+	// Disconnected subscribers are skipped
+	connections[0].Disconnect();
+	connections[5].Disconnect();
+	multicast(&param, TEST_INT);
+	flush();
+	flushOther();
+	ASSERT_TRUE(logs[0].size() == SUBSCRIBERS / 2 - 1 && logs[0][0] == 2);
+	ASSERT_TRUE(logs[1].size() == SUBSCRIBERS / 2 - 1 && logs[1][2] == 7);
+	logs[0].clear();
+	logs[1].clear();
+
+	// Without coalescing each subscriber gets its own message and copy
+	multicast.SetCoalesce(false);
+	StartAllocCount();
+	multicast(&param, TEST_INT);
+	cnt = StopAllocCount();
+	flush();
+	flushOther();
+#if DELEGATE_ALLOC_COUNT_TESTS && !USE_DELEGATE_POOLS && !USE_XALLOCATOR
+	ASSERT_TRUE(cnt == SUBSCRIBERS - 2);
+#endif
+	ASSERT_TRUE(logs[0].size() == SUBSCRIBERS / 2 - 1 && logs[1].size() == SUBSCRIBERS / 2 - 1);
+
+	multicast.Clear();
+	otherThread.ExitThread();
+}
+
+/// An object with its own fixed block pool
+class PoolTestObject
+{
+	DELEGATE_POOL(PoolTestObject)
+public:
+	PoolTestObject(int v) : value(v) { }
+	int value;
+	char pad[40];
+};
+
+void PoolTestConsume(std::unique_ptr<PoolTestObject> object, int value)
+{
+	ASSERT_TRUE(object->value == value);
+}
+
+void DelegatePoolTests(WorkerThread& thread)
+{
+	DelegatePool<PoolTestObject>& pool = DelegatePool<PoolTestObject>::Instance();
+	ASSERT_TRUE(pool.GetBlockCount() == DELEGATE_POOL_BLOCKS);
+	ASSERT_TRUE(pool.GetBlockSize() >= sizeof(PoolTestObject));
+	ASSERT_TRUE(pool.GetBlockSize() % alignof(std::max_align_t) == 0);
+
+	bool listed = false;
+	for (DelegatePoolBase* p = DelegatePoolBase::GetFirst(); p; p = p->GetNext())
+		listed = listed || p == &pool;
+	ASSERT_TRUE(listed);
+
+	// Objects beyond the pool's capacity come from the heap
+	const int OVERFLOW_CNT = 8;
+	UINT overflows = pool.GetOverflows();
+	std::vector<PoolTestObject*> objects;
+	objects.reserve(DELEGATE_POOL_BLOCKS + OVERFLOW_CNT);
+	StartAllocCount();
+	for (int i = 0; i < DELEGATE_POOL_BLOCKS; i++)
+		objects.push_back(new PoolTestObject(i));
+	int cnt = StopAllocCount();
+	ASSERT_TRUE(cnt == 0);
+	ASSERT_TRUE(pool.GetBlocksInUse() == DELEGATE_POOL_BLOCKS);
+	ASSERT_TRUE(pool.GetMaxBlocksInUse() == DELEGATE_POOL_BLOCKS);
+	ASSERT_TRUE(pool.GetOverflows() == overflows);
+
+	StartAllocCount();
+	for (int i = 0; i < OVERFLOW_CNT; i++)
+		objects.push_back(new PoolTestObject(DELEGATE_POOL_BLOCKS + i));
+	int overflowCnt = StopAllocCount();
+	ASSERT_TRUE(pool.GetOverflows() == overflows + OVERFLOW_CNT);
+#if DELEGATE_ALLOC_COUNT_TESTS && !USE_XALLOCATOR
+	ASSERT_TRUE(overflowCnt == OVERFLOW_CNT);
+#endif
+
+	for (size_t i = 0; i < objects.size(); i++) {
+		ASSERT_TRUE(objects[i]->value == (int)i);
+		delete objects[i];
+	}
+	ASSERT_TRUE(pool.GetBlocksInUse() == 0);
+	ASSERT_TRUE(pool.GetMaxBlocksInUse() == DELEGATE_POOL_BLOCKS);
+
+	// Create on this thread, delete on the target thread. The pool is reused 
+	// without touching the heap.
+	DelegateFreeAsync2<std::unique_ptr<PoolTestObject>, int> consume = MakeDelegate(&PoolTestConsume, &thread);
+	DelegateFreeAsyncWait0<void> flush = MakeDelegate(&FreeFunc0, &thread, WAIT_INFINITE);
+	for (int i = 0; i < DELEGATE_POOL_BLOCKS * 4; i++) {
+		if (i % (DELEGATE_POOL_BLOCKS / 2) == 0)
+			flush();
+		consume(std::unique_ptr<PoolTestObject>(new PoolTestObject(i)), i);
+	}
+	flush();
+	ASSERT_TRUE(pool.GetBlocksInUse() == 0);
+	ASSERT_TRUE(pool.GetOverflows() == overflows + OVERFLOW_CNT);
+
+#if USE_DELEGATE_POOLS
+	// Asynchronous messages and delegate copies come from their type's pool
+	typedef DelegateAsyncMsg<DelegateFree<void(int)>, int> Msg;
+	DelegateFreeAsync1<int> delegate = MakeDelegate(&FreeFuncInt1, &thread);
+	MulticastDelegateSafe1<int> multicast;
+	multicast += delegate;
+	StartAllocCount();
+	delegate(TEST_INT);
+	multicast(TEST_INT);
+	cnt = StopAllocCount();
+	flush();
+	ASSERT_TRUE(cnt == 0);
+	ASSERT_TRUE(DelegatePool<Msg>::Instance().GetMaxBlocksInUse() >= 1);
+	ASSERT_TRUE(DelegatePool<DelegateFreeAsync<void(int)> >::Instance().GetBlocksInUse() >= 1);
+	multicast.Clear();
+#endif
+}
+
+void AllocCountTests()
+{
+	AllocCountThread(testThread);
+	AllocCountArgs(testThread);
+	AllocCountMove(testThread);
+
+#if USE_STD_THREADS
+	WorkerThread lockFreeThread("AllocCountLockFreeThread", WorkerThread::QUEUE_LOCK_FREE);
+	lockFreeThread.CreateThread();
+	AllocCountThread(lockFreeThread);
+	lockFreeThread.ExitThread();
 #endif
 }
 
@@ -2568,14 +4673,15 @@ void DelegateUnitTests()
 	{
 		SinglecastDelegateTests();
 		MulticastDelegateTests();
+		MulticastDelegateOrderTests();
+		DelegateConnectionTests();
 		MulticastDelegateSafeTests();
 		MulticastDelegateSafeAsyncTests();
 		DelegateMemberAsyncWaitTests();
+		VariadicDelegateTests();
 
-#if USE_CPLUSPLUS_11
 		DelegateMemberSpTests();
 		DelegateMemberAsyncSpTests();
-#endif
 	}
 
 #ifdef WIN32
@@ -2586,6 +4692,32 @@ void DelegateUnitTests()
 	std::cout << "Elapsed Time: " << (float)ElapsedMicroseconds.QuadPart / 1000000.0f << " seconds" << std::endl;
 #endif
 
+	DelegateRemoteTests();
+
+#if USE_STD_THREADS
+	WorkerThreadLockFreeTests();
+	WorkerThreadBatchDrainTests();
+	WorkerThreadPriorityTests();
+	WorkerThreadCapacityTests();
+	TimerWheelTests();
+	TimerTests();
+	DelegateThreadPoolTests();
+	DelegateStrandTests();
+	DelegateStrandRejectTests();
+	MulticastDelegateSafeSnapshotTests();
+	MulticastDelegateParallelTests();
+	XallocatorTests();
+	AllocatorLockFreeTests();
+#endif
+#if DELEGATE_ALLOC_COUNT_TESTS && !USE_DELEGATE_POOLS && !USE_XALLOCATOR
+	// The counts assume messages and delegate copies come from the heap
+	AllocCountTests();
+#endif
+	DelegateParamTests(testThread);
+	DelegateBufferTests(testThread);
+	DelegateCoalesceTests(testThread);
+	DelegatePoolTests(testThread);
+
 	testThread.ExitThread();
 }
 
@@ -0,0 +1,195 @@
+#ifndef _MPSC_QUEUE_H
+#define _MPSC_QUEUE_H
+
+#include "DelegateOpt.h"
+
+#include <atomic>
+#include <cstddef>
+
+namespace DelegateLib {
+
+/// @brief Intrusive link for objects placed into a MpscQueue or IntrusiveQueue. 
+/// A node may be in at most one queue at a time.
+class QueueNode
+{
+public:
+	QueueNode() : m_next(nullptr) { }
+
+private:
+	friend class MpscQueue;
+	friend class IntrusiveQueue;
+
+	// Nodes are never copied between queues by value
+	QueueNode(const QueueNode&);
+	QueueNode& operator=(const QueueNode&);
+
+	std::atomic<QueueNode*> m_next;
+};
+
+/// @brief An intrusive FIFO queue of QueueNode instances. Not thread-safe; the 
+/// caller provides any locking. Push and Pop are O(1) and never allocate.
+class IntrusiveQueue
+{
+public:
+	IntrusiveQueue() : m_head(nullptr), m_tail(nullptr), m_size(0) { }
+
+	/// Add a node to the back of the queue. 
+	void Push(QueueNode* node)
+	{
+		node->m_next.store(nullptr, std::memory_order_relaxed);
+		if (m_tail)
+			m_tail->m_next.store(node, std::memory_order_relaxed);
+		else
+			m_head = node;
+		m_tail = node;
+		m_size++;
+	}
+
+	/// Remove the node at the front of the queue. 
+	/// @return The oldest node, or NULL if the queue is empty.
+	QueueNode* Pop()
+	{
+		QueueNode* node = m_head;
+		if (node)
+		{
+			m_head = node->m_next.load(std::memory_order_relaxed);
+			if (!m_head)
+				m_tail = nullptr;
+			m_size--;
+		}
+		return node;
+	}
+
+	/// Returns true if no nodes are queued.
+	bool Empty() const { return m_head == nullptr; }
+
+	/// Get the number of nodes queued.
+	size_t Size() const { return m_size; }
+
+	/// Move nodes from the front of another queue to the back of this queue.
+	/// @param[in] src - the queue to take nodes from.
+	/// @param[in] maxNodes - the maximum number of nodes to move. 0 moves every 
+	///		node in O(1). Otherwise the cost is O(maxNodes).
+	/// @return The number of nodes moved. 
+	size_t Splice(IntrusiveQueue& src, size_t maxNodes)
+	{
+		if (src.Empty())
+			return 0;
+
+		QueueNode* first = src.m_head;
+		QueueNode* last = src.m_tail;
+		size_t cnt = src.m_size;
+		if (maxNodes != 0 && maxNodes < src.m_size)
+		{
+			last = first;
+			for (cnt = 1; cnt < maxNodes; cnt++)
+				last = last->m_next.load(std::memory_order_relaxed);
+		}
+
+		src.m_head = last->m_next.load(std::memory_order_relaxed);
+		if (!src.m_head)
+			src.m_tail = nullptr;
+		last->m_next.store(nullptr, std::memory_order_relaxed);
+
+		if (m_tail)
+			m_tail->m_next.store(first, std::memory_order_relaxed);
+		else
+			m_head = first;
+		m_tail = last;
+
+		src.m_size -= cnt;
+		m_size += cnt;
+		return cnt;
+	}
+
+private:
+	// Prevent copying objects
+	IntrusiveQueue(const IntrusiveQueue&);
+	IntrusiveQueue& operator=(const IntrusiveQueue&);
+
+	QueueNode* m_head;
+	QueueNode* m_tail;
+	size_t m_size;
+};
+
+/// @brief A lock-free, intrusive, unbounded multi-producer/single-consumer FIFO
+/// queue (Vyukov algorithm). Any number of threads may call Push() concurrently.
+/// Only one thread, the consumer, may call Pop() and Empty().
+///
+/// Push() is wait-free: a single atomic exchange and a store. Pop() never blocks,
+/// but can return NULL while a producer is between those two instructions even
+/// though Empty() returns false. Callers should yield and retry in that case.
+class MpscQueue
+{
+public:
+	MpscQueue() : m_head(&m_stub), m_tail(&m_stub) { }
+
+	/// Add a node to the back of the queue. Safe to call from any thread.
+	/// @param[in] node - the node to add. The queue does not take ownership.
+	void Push(QueueNode* node)
+	{
+		node->m_next.store(nullptr, std::memory_order_relaxed);
+		QueueNode* prev = m_head.exchange(node);
+		prev->m_next.store(node, std::memory_order_release);
+	}
+
+	/// Remove the node at the front of the queue. Consumer thread only.
+	/// @return The oldest node, or NULL if the queue is empty or a push is
+	///		still in progress.
+	QueueNode* Pop()
+	{
+		QueueNode* tail = m_tail;
+		QueueNode* next = tail->m_next.load(std::memory_order_acquire);
+		if (tail == &m_stub)
+		{
+			if (next == nullptr)
+				return nullptr;
+			m_tail = next;
+			tail = next;
+			next = next->m_next.load(std::memory_order_acquire);
+		}
+		if (next)
+		{
+			m_tail = next;
+			return tail;
+		}
+		if (tail != m_head.load())
+			return nullptr;
+
+		// Last node in the queue. Re-insert the stub so the node can be unlinked.
+		Push(&m_stub);
+		next = tail->m_next.load(std::memory_order_acquire);
+		if (next)
+		{
+			m_tail = next;
+			return tail;
+		}
+		return nullptr;
+	}
+
+	/// Returns true if no nodes are queued or being pushed. Consumer thread only.
+	/// Uses a sequentially consistent load so that a consumer that publishes a
+	/// "sleeping" flag before calling Empty() cannot miss a concurrent Push().
+	bool Empty() const
+	{
+		return m_tail == &m_stub && m_head.load() == &m_stub;
+	}
+
+private:
+	// Prevent copying objects
+	MpscQueue(const MpscQueue&);
+	MpscQueue& operator=(const MpscQueue&);
+
+	/// Producers push onto the head
+	std::atomic<QueueNode*> m_head;
+
+	/// Consumer pops from the tail
+	QueueNode* m_tail;
+
+	/// Dummy node that keeps the list non-empty
+	QueueNode m_stub;
+};
+
+}
+
+#endif
@@ -1,31 +1,184 @@
 #include "MulticastDelegateBase.h"
+#include "DelegateThread.h"
+#include "LockGuard.h"
+#include "Semaphore.h"
+#include <atomic>
+#if USE_DELEGATE_POOLS
+	#include "DelegatePool.h"
+#endif
 
 namespace DelegateLib {
 
+/// @brief The state of one parallel invocation, shared by the calling thread 
+/// and the tasks dispatched to the pool. Parts are claimed one at a time by 
+/// whichever thread gets there first, so the calling thread runs any parts 
+/// the pool has not started and never waits on a queued or discarded task. 
+/// A task arriving after every part is claimed only releases its reference.
+class MulticastDelegateBase::ParallelInvoke
+{
+#if USE_DELEGATE_POOLS
+	DELEGATE_POOL(ParallelInvoke)
+#elif USE_XALLOCATOR
+	XALLOCATOR
+#endif
+public:
+	ParallelInvoke(ParallelRange& range, const Invocation* invocation, size_t count, size_t parts) :
+		m_range(range), m_invocation(invocation), m_count(count), m_parts(parts),
+		m_next(0), m_done(0), m_disconnected(0), m_refCnt(1)
+	{
+		LockGuard::Create(&m_lock);
+		m_sema.Create();
+		m_sema.Reset();
+	}
+
+	void AddRef() { m_refCnt.fetch_add(1, std::memory_order_relaxed); }
+
+	void Release() {
+		if (m_refCnt.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			delete this;
+	}
+
+	/// Claim and run parts until none remain
+	void Run();
+
+	/// Called by the calling thread to wait for parts run by the pool
+	/// @return The number of disconnected entries skipped.
+	size_t Wait();
+
+private:
+	~ParallelInvoke() { LockGuard::Destroy(&m_lock); }
+
+	// Prevent copying objects
+	ParallelInvoke(const ParallelInvoke&);
+	ParallelInvoke& operator=(const ParallelInvoke&);
+
+	ParallelRange& m_range;
+	const Invocation* m_invocation;
+	const size_t m_count;
+	const size_t m_parts;
+	size_t m_next;					// The next part to claim
+	size_t m_done;					// The number of parts completed
+	size_t m_disconnected;
+	std::atomic<int> m_refCnt;
+	LOCK m_lock;
+	Semaphore m_sema;				// Signaled once every part completes
+};
+
+/// @brief A message that runs parts of a parallel invocation on the pool
+class MulticastDelegateBase::ParallelTask final : public IDelegateInvoker, public DelegateMsgBase
+{
+#if USE_DELEGATE_POOLS
+	DELEGATE_POOL(ParallelTask)
+#endif
+public:
+	ParallelTask(ParallelInvoke* invoke) : DelegateMsgBase(this), m_invoke(invoke) { invoke->AddRef(); }
+
+	/// Called by the pool, or when the pool discards the message
+	virtual void DelegateInvoke(DelegateMsgBase** msg) {
+		if (!IsDiscarded())
+			m_invoke->Run();
+		m_invoke->Release();
+		*msg = 0;
+		delete this;
+	}
+
+private:
+	ParallelInvoke* m_invoke;
+};
+
+//------------------------------------------------------------------------------
+// ParallelInvoke::Run
+//------------------------------------------------------------------------------
+void MulticastDelegateBase::ParallelInvoke::Run()
+{
+	for (;;)
+	{
+		size_t part;
+		{
+			LockGuard lockGuard(&m_lock);
+			if (m_next == m_parts)
+				return;
+			part = m_next++;
+		}
+
+		// Spread the remainder so part sizes differ by at most one
+		size_t begin = part * m_count / m_parts;
+		size_t end = (part + 1) * m_count / m_parts;
+		size_t disconnected = m_range.InvokeRange(m_invocation + begin, end - begin);
+
+		LockGuard lockGuard(&m_lock);
+		m_disconnected += disconnected;
+		if (++m_done == m_parts)
+			m_sema.Signal();
+	}
+}
+
+//------------------------------------------------------------------------------
+// ParallelInvoke::Wait
+//------------------------------------------------------------------------------
+size_t MulticastDelegateBase::ParallelInvoke::Wait()
+{
+	m_sema.Wait(-1);
+	LockGuard lockGuard(&m_lock);
+	return m_disconnected;
+}
+
+//------------------------------------------------------------------------------
+// Empty
+//------------------------------------------------------------------------------
+bool MulticastDelegateBase::Empty() const
+{
+	for (size_t i = 0; i < m_count; i++)
+	{
+		if (m_invocation[i].node->IsConnected())
+			return false;
+	}
+	return true;
+}
+
 //------------------------------------------------------------------------------
 // operator+=
 //------------------------------------------------------------------------------
-void MulticastDelegateBase::operator+=(const DelegateBase& delegate)
+DelegateConnection MulticastDelegateBase::operator+=(const DelegateBase& delegate)
 {
-	InvocationNode* node = new InvocationNode();
-	node->Delegate = delegate.Clone();
-	
-	// First element in the list?
-	if (m_invocationHead == 0)
+	DelegateConnectionNode* node = new DelegateConnectionNode(delegate.Clone());
+
+	// Reuse the space of disconnected entries once they are half the list, 
+	// otherwise grow. Either way the next scan is at least m_count / 2 
+	// appends away, so appending stays amortized constant time.
+	if (m_count == m_capacity && m_invoking == 0)
 	{
-		// Set the head element
-		m_invocationHead = node;
+		size_t disconnected = 0;
+		for (size_t i = 0; i < m_count; i++)
+		{
+			if (!m_invocation[i].node->IsConnected())
+				disconnected++;
+		}
+		if (disconnected * 2 >= m_count)
+			Compact();
 	}
-	else
+
+	// Grow the list geometrically so appending is amortized constant time
+	if (m_count == m_capacity)
 	{
-		// Iterate over list until the end of list is found
-		InvocationNode* curr = m_invocationHead;
-		while (curr->Next != 0)
-			curr = curr->Next;
-		
-		// Set the info pointer at the end of the list
-		curr->Next = node;
+		size_t capacity = m_capacity * 2;
+		Invocation* invocation = new Invocation[capacity];
+		for (size_t i = 0; i < m_count; i++)
+			invocation[i] = m_invocation[i];
+
+		if (m_invocation != m_inline)
+			delete [] m_invocation;
+		m_invocation = invocation;
+		m_capacity = capacity;
 	}
+
+	// Add to the end of the list
+	m_invocation[m_count].delegate = node->GetDelegate();
+	m_invocation[m_count].node = node;
+	m_count++;
+
+	// The handle takes a second reference; the list keeps the first
+	return DelegateConnection(node);
 }
 
 //------------------------------------------------------------------------------
@@ -34,40 +187,110 @@ void MulticastDelegateBase::operator+=(const DelegateBase& delegate)
 void MulticastDelegateBase::operator-=(const DelegateBase& delegate)
 {
 	// Iterate over list to find delegate to remove
-	InvocationNode* curr = m_invocationHead;
-	InvocationNode* prev = 0;
-	while (curr != 0)
+	for (size_t i = 0; i < m_count; i++)
 	{
+		DelegateConnectionNode* node = m_invocation[i].node;
+
 		// Is this the delegate to remove?
-		if (*curr->Delegate == delegate)
+		if (node->IsConnected() && *node->GetDelegate() == delegate)
 		{
-			if (curr == m_invocationHead)
-				m_invocationHead = curr->Next;
-			else
-				prev->Next = curr->Next;
-			
-			delete curr->Delegate;
-			delete curr;
+			node->Disconnect();
+
+			// Close the gap, keeping the remaining delegates in order. While 
+			// invoking, the entry is left for EndInvoke() to drop.
+			if (m_invoking == 0)
+			{
+				for (size_t j = i + 1; j < m_count; j++)
+					m_invocation[j - 1] = m_invocation[j];
+				m_count--;
+				node->Release();
+			}
 			break;
 		}
-		prev = curr;
-		curr = curr->Next;
 	}	
 }
 
 //------------------------------------------------------------------------------
-// Clear
+// EndInvoke
 //------------------------------------------------------------------------------
-void MulticastDelegateBase::Clear()
+void MulticastDelegateBase::EndInvoke(size_t disconnected)
+{
+	m_invoking--;
+
+	// Drop disconnected entries once they are half the list, so each 
+	// disconnect costs amortized constant time
+	if (disconnected * 2 > m_count || (disconnected && m_count <= INLINE_DELEGATES))
+		Compact();
+}
+
+//------------------------------------------------------------------------------
+// SetParallel
+//------------------------------------------------------------------------------
+void MulticastDelegateBase::SetParallel(DelegateThread* pool, size_t parts)
 {
-	while (m_invocationHead)
+	ASSERT_TRUE(pool == 0 || parts > 1);
+	m_parallelThread = pool;
+	m_parallelParts = pool ? parts : 0;
+}
+
+//------------------------------------------------------------------------------
+// InvokeParallel
+//------------------------------------------------------------------------------
+size_t MulticastDelegateBase::InvokeParallel(ParallelRange& range)
+{
+	size_t parts = m_parallelParts < m_count ? m_parallelParts : m_count;
+	ParallelInvoke* invoke = new ParallelInvoke(range, m_invocation, m_count, parts);
+
+	// One task per part beyond the calling thread's. A rejected task is 
+	// discarded and its part is run by the calling thread instead.
+	for (size_t i = 1; i < parts; i++)
+		m_parallelThread->DispatchDelegate(new ParallelTask(invoke));
+
+	invoke->Run();
+	size_t disconnected = invoke->Wait();
+	invoke->Release();
+	return disconnected;
+}
+
+//------------------------------------------------------------------------------
+// Compact
+//------------------------------------------------------------------------------
+void MulticastDelegateBase::Compact()
+{
+	if (m_invoking != 0)
+		return;
+
+	size_t count = 0;
+	for (size_t i = 0; i < m_count; i++)
 	{
-		InvocationNode* curr = m_invocationHead;
-		m_invocationHead = curr->Next;
-		delete curr->Delegate;
-		delete curr;
+		if (m_invocation[i].node->IsConnected())
+			m_invocation[count++] = m_invocation[i];
+		else
+			m_invocation[i].node->Release();
 	}
+	m_count = count;
 }
 
+//------------------------------------------------------------------------------
+// Clear
+//------------------------------------------------------------------------------
+void MulticastDelegateBase::Clear()
+{
+	for (size_t i = 0; i < m_count; i++)
+		m_invocation[i].node->Disconnect();
+
+	// Leave the disconnected entries for EndInvoke() if called from a callback
+	if (m_invoking != 0)
+		return;
+
+	for (size_t i = 0; i < m_count; i++)
+		m_invocation[i].node->Release();
+
+	if (m_invocation != m_inline)
+		delete [] m_invocation;
+	m_invocation = m_inline;
+	m_count = 0;
+	m_capacity = INLINE_DELEGATES;
 }
 
+}
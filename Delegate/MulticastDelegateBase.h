@@ -2,9 +2,13 @@
 #define _MULTICAST_DELEGATE_BASE_H
 
 #include "Delegate.h"
+#include "DelegateConnection.h"
+#include <cstddef>
 
 namespace DelegateLib {
 
+class DelegateThread;
+
 /// @brief A non-template base class for the multicast delegates. 
 /// @details Since the MulticastDelegate template class inherits from this class, 
 /// as much code is placed into this base class as possible to minimize the
@@ -13,62 +17,129 @@ class MulticastDelegateBase
 {
 public:
 	/// Constructor
-	MulticastDelegateBase() : m_invocationHead(0) {}
+	MulticastDelegateBase() : 
+		m_invocation(m_inline), m_count(0), m_capacity(INLINE_DELEGATES), m_invoking(0),
+		m_parallelThread(0), m_parallelParts(0) {}
 
 	/// Destructor
 	virtual ~MulticastDelegateBase() { Clear(); }
 
 	/// Any registered delegates?
-	bool Empty() const { return !m_invocationHead; }
+	bool Empty() const;
 
-	/// Removal all registered delegates.
+	/// Removal all registered delegates. Their connections are disconnected.
 	void Clear();
 
-protected:
-	struct InvocationNode
-	{
-		InvocationNode() : Next(0), Delegate(0) { }
-		InvocationNode* Next;
-		DelegateBase* Delegate;
-	};
+	/// Invoke the delegates in parallel rather than one after another on the 
+	/// calling thread. The invocation list is split into parts that run on 
+	/// the pool and on the calling thread, which returns once every delegate 
+	/// has been called. Delegates then run concurrently and in no particular 
+	/// order, each copying the same arguments. While invoked in parallel, a 
+	/// callback may disconnect delegates but must not register delegates with 
+	/// or invoke the container. Sequential invocation is the default.
+	/// @param[in] pool - the thread to run parts on, typically a DelegateThreadPool.
+	///		0 restores sequential invocation. 
+	/// @param[in] parts - the most parts to split the list into, including the 
+	///		one run by the calling thread. Typically the pool's thread count plus one. 
+	void SetParallel(DelegateThread* pool, size_t parts);
 
+	/// Get the pool set by SetParallel(), or 0 when invoked sequentially
+	DelegateThread* GetParallelThread() const { return m_parallelThread; }
+
+protected:
 	/// Insert a delegate into the invocation list. A delegate argument 
 	/// pointer is not stored. Instead, the DelegateBase derived object is 
 	/// copied (cloned) and saved in the invocation list.
 	/// @param[in] delegate - a delegate to register. 
-	void operator+=(const DelegateBase& delegate);
+	/// @return A handle to unregister the delegate in constant time. 
+	DelegateConnection operator+=(const DelegateBase& delegate);
 
 	/// Remove a delegate previously registered delegate from the invocation
 	/// list. 
 	/// @param[in] delegate - a delegate to unregister. 
 	void operator-=(const DelegateBase& delegate);
 
-	/// Get the head of the delegate invocation list. 
-	/// @return Pointer to the head of the invocation list. 
-	InvocationNode* GetInvocationHead() { return m_invocationHead; }
+	/// Get the number of entries in the invocation list, including 
+	/// disconnected entries not yet dropped.
+	size_t GetInvocationCount() const { return m_count; }
+
+	/// An invocation list entry. The delegate pointer is kept alongside its 
+	/// node so invoking does not wait on loading the node first. 
+	struct Invocation
+	{
+		DelegateBase* delegate;
+		DelegateConnectionNode* node;
+	};
+
+	/// Get an entry from the invocation list. Entries are kept in the 
+	/// order registered; skip those no longer connected. 
+	/// @param[in] index - the position in the list, less than GetInvocationCount().
+	const Invocation& GetInvocation(size_t index) const { return m_invocation[index]; }
+
+	/// Called before iterating over the invocation list. Entries are not 
+	/// dropped or moved until the matching EndInvoke(). 
+	void BeginInvoke() { m_invoking++; }
+
+	/// Called after iterating over the invocation list. 
+	/// @param[in] disconnected - the number of disconnected entries skipped.
+	void EndInvoke(size_t disconnected);
+
+	/// @brief Calls a range of the invocation list with the caller's arguments. 
+	/// Implemented by the template container, which knows the argument types.
+	class ParallelRange
+	{
+	public:
+		/// Call the connected delegates in a range. Called concurrently.
+		/// @param[in] invocation - the first entry.
+		/// @param[in] count - the number of entries.
+		/// @return The number of disconnected entries skipped.
+		virtual size_t InvokeRange(const Invocation* invocation, size_t count) = 0;
+
+	protected:
+		~ParallelRange() { }
+	};
+
+	/// Returns true if SetParallel() applies to an invocation list this long
+	bool IsParallel() const { return m_parallelThread != 0 && m_count > 1; }
+
+	/// Call the invocation list in parts on the pool set by SetParallel() and 
+	/// the calling thread. Returns once every part has run. Call between 
+	/// BeginInvoke() and EndInvoke().
+	/// @param[in] range - calls each part.
+	/// @return The number of disconnected entries skipped.
+	size_t InvokeParallel(ParallelRange& range);
 
-#if USE_CPLUSPLUS_11
 public:
-	// New-school safe bool
 	explicit operator bool() const { return !Empty();  }
-#else
-public:
-	// Old-school safe bool idiom
-    typedef void (MulticastDelegateBase::*bool_type)() const;
-    void this_type_does_not_support_comparisons() const {}
-	operator bool_type() const {
-		return Empty()? 0 : &MulticastDelegateBase::this_type_does_not_support_comparisons;
-    }
-	bool operator !() const { return Empty(); }
-#endif
 
 private:
 	// Prevent copying objects
 	MulticastDelegateBase(const MulticastDelegateBase&);
 	MulticastDelegateBase& operator=(const MulticastDelegateBase&);
 
-	/// Head pointer to the delegate invocation list
-	InvocationNode* m_invocationHead;
+	/// Invocation lists up to this length are stored inside the container
+	enum { INLINE_DELEGATES = 4 };
+
+	/// Drop disconnected entries, keeping the rest in order. Does nothing 
+	/// while the list is being invoked. 
+	void Compact();
+
+	class ParallelInvoke;
+	class ParallelTask;
+
+	/// The delegate invocation list. Points to m_inline until the list 
+	/// outgrows it, then to a heap array that doubles as required. 
+	Invocation* m_invocation;
+	size_t m_count;
+	size_t m_capacity;
+	Invocation m_inline[INLINE_DELEGATES];
+
+	/// Nesting depth of invocations in progress
+	int m_invoking;
+
+	/// The pool and number of parts for parallel invocation
+	DelegateThread* m_parallelThread;
+	size_t m_parallelParts;
 };
 
 }
@@ -3,303 +3,302 @@
 
 #include "MulticastDelegate.h"
 #include "LockGuard.h"
+#include "DelegateConnection.h"
+#include "DelegateAsync.h"
+#include <atomic>
+#include <memory>
+#include <vector>
 
 namespace DelegateLib {
 
 /// @brief Thread-safe multicast delegate container class. May contain any delegate,
 /// but typically used to hold DelegateMemberAsync<> or DelegateFreeAsync<> instances.
-class MulticastDelegateSafe0 : public MulticastDelegate0
+///
+/// The invocation list is copy-on-write. operator() takes a snapshot of the list 
+/// with a single atomic load and invokes it without holding a lock, so a slow 
+/// subscriber does not block other publishers or subscribers, and a callback may 
+/// safely register or unregister delegates on the container it is invoked from. 
+/// Writers are serialized by a lock and publish a new list each time. A delegate 
+/// removed while a publish is in progress on another thread may be invoked once 
+/// more by that publish. 
+///
+/// operator+= returns a DelegateConnection that unregisters the delegate in 
+/// constant time from any thread. The entry is dropped from the list by the next 
+/// writer, or by a publisher once disconnected entries are half the list.
+///
+/// Publishers on different threads may invoke the same delegate instance at once. 
+/// The last call status of a DelegateMemberAsyncWait<> or DelegateFreeAsyncWait<> 
+/// held in the container is therefore unspecified. 
+template <class Signature>
+class MulticastDelegateSafe;
+
+template <class... Args>
+class MulticastDelegateSafe<void(Args...)>
 {
 public:
-	MulticastDelegateSafe0() { LockGuard::Create(&m_lock); }
-	~MulticastDelegateSafe0() { LockGuard::Destroy(&m_lock); }
-
-	void operator+=(const Delegate0<>& delegate) { 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate0::operator +=(delegate); 
-	}
-	void operator-=(const Delegate0<>& delegate)	{ 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate0::operator -=(delegate); 
-	}
-	void operator()() {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate0::operator ()(); 
+	MulticastDelegateSafe() : m_coalesce(false) { LockGuard::Create(&m_lock); }
+	~MulticastDelegateSafe() {
+		Clear();
+		LockGuard::Destroy(&m_lock);
+	}
+
+	DelegateConnection operator+=(const Delegate<void(Args...)>& delegate) { 
+		Invocation invocation;
+		Delegate<void(Args...)>* clone = delegate.Clone();
+		DelegateConnectionNode* node = new DelegateConnectionNode(clone);
+		invocation.connection = DelegateConnection(node);
+		node->Release();
+
+		// Note whether the delegate's messages may be shared with others
+		invocation.coalesce = dynamic_cast<DelegateAsyncCoalesce<Args...>*>(clone);
+		if (invocation.coalesce && !invocation.coalesce->GetThread())
+			invocation.coalesce = 0;
+		DelegateAsyncBase* async = dynamic_cast<DelegateAsyncBase*>(clone);
+		invocation.priority = async ? async->GetPriority() : PRIORITY_NORMAL;
+
+		LockGuard lockGuard(&m_lock);
+		std::shared_ptr<InvocationList> newList = Copy(Load(), 1);
+		newList->push_back(invocation);
+		Link(*newList);
+		Store(newList);
+		return invocation.connection;
+	}
+	void operator-=(const Delegate<void(Args...)>& delegate)	{ 
+		LockGuard lockGuard(&m_lock);
+		InvocationListPtr list = Load();
+		if (!list)
+			return;
+		for (size_t i = 0; i < list->size(); i++) {
+			DelegateConnectionNode* node = (*list)[i].connection.GetNode();
+			if (node->IsConnected() && *node->GetDelegate() == delegate) {
+				node->Disconnect();
+				Store(Copy(list, 0));
+				break;
+			}
+		}
+	}
+	void operator()(Args... args) {
+		// The snapshot keeps its delegates alive while they are invoked, even if 
+		// they are removed from the container meanwhile
+		InvocationListPtr list = Load();
+		if (!list)
+			return;
+		bool coalesce = m_coalesce.load(std::memory_order_relaxed);
+		size_t disconnected = 0;
+		for (size_t i = 0; i < list->size(); i++) {
+			const Invocation& invocation = (*list)[i];
+
+			// Send one message for each group of delegates sharing a thread
+			if (coalesce && invocation.coalesce) {
+				if (!invocation.connection.IsConnected())
+					disconnected++;
+				if (invocation.first)
+					invocation.coalesce->DispatchShared(new CoalescedMsg(list, i, args...));
+				continue;
+			}
+
+			DelegateConnectionNode* node = invocation.connection.GetNode();
+			if (!node->IsConnected()) {
+				disconnected++;
+				continue;
+			}
+			(*static_cast<Delegate<void(Args...)>*>(node->GetDelegate()))(args...);	// Invoke delegate callback
+		}
+
+		// Drop disconnected entries once they are half the list, so each 
+		// disconnect costs amortized constant time
+		if (disconnected * 2 > list->size()) {
+			LockGuard lockGuard(&m_lock);
+			Store(Copy(Load(), 0));
+		}
 	}
 	bool Empty() { 
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegate0::Empty();
+		InvocationListPtr list = Load();
+		if (list) {
+			for (size_t i = 0; i < list->size(); i++) {
+				if ((*list)[i].connection.IsConnected())
+					return false;
+			}
+		}
+		return true;
 	}
 	void Clear() {
 		LockGuard lockGuard(&m_lock);
-		return MulticastDelegate0::Clear();
-	}
-
-#if USE_CPLUSPLUS_11
-	explicit operator bool() {
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegateBase::operator bool();
+		InvocationListPtr list = Load();
+		if (list) {
+			for (size_t i = 0; i < list->size(); i++)
+				(*list)[i].connection.GetNode()->Disconnect();
+		}
+		Store(InvocationListPtr());
 	}
-#else
-	operator bool_type() {
-		return Empty()? 0 : &MulticastDelegateBase::this_type_does_not_support_comparisons;
-    }
-	bool operator !() { return Empty(); }
-#endif
-
-private:
-	// Prevent copying objects
-	MulticastDelegateSafe0(const MulticastDelegateSafe0&);
-	MulticastDelegateSafe0& operator=(const MulticastDelegateSafe0&);
-
-	/// Lock to make the class thread-safe
-	LOCK m_lock;
-};
 
-template<typename Param1>
-class MulticastDelegateSafe1 : public MulticastDelegate1<Param1>
-{
-public:
-	MulticastDelegateSafe1() { LockGuard::Create(&m_lock); }
-	~MulticastDelegateSafe1() { LockGuard::Destroy(&m_lock); }
+	/// Share messages between asynchronous delegates bound to the same thread. 
+	/// When enabled, each invocation sends one message per thread, and per 
+	/// priority, holding one copy of the arguments, instead of one message and 
+	/// argument copy per delegate. On arrival the message calls each of the 
+	/// thread's DelegateMemberAsync<> and DelegateFreeAsync<> target functions in 
+	/// the order registered. Other delegates are invoked as usual. 
+	/// 
+	/// The target functions on a thread share the copy of a pointer or reference 
+	/// argument, so a change one makes through a non-const argument is seen by 
+	/// the next. Pass by value arguments are copied to each.
+	/// @param[in] coalesce - true to share messages, false to send one per delegate.
+	void SetCoalesce(bool coalesce) { m_coalesce.store(coalesce, std::memory_order_relaxed); }
 
-	void operator+=(const Delegate1<Param1>& delegate) { 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate1<Param1>::operator +=(delegate); 
-	}
-	void operator-=(const Delegate1<Param1>& delegate)	{ 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate1<Param1>::operator -=(delegate); 
-	}
-	void operator()(Param1 p1) {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate1<Param1>::operator ()(p1); 
-	}
-	bool Empty() { 
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegate1<Param1>::Empty();
-	}
-	void Clear() {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate1<Param1>::Clear();
-	}
+	/// Returns true if messages are shared, see SetCoalesce()
+	bool GetCoalesce() const { return m_coalesce.load(std::memory_order_relaxed); }
 
-#if USE_CPLUSPLUS_11
-	explicit operator bool() {
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegateBase::operator bool();
-	}
-#else
-	operator typename MulticastDelegate1<Param1>::bool_type() {
-		return Empty()? 0 : &MulticastDelegateBase::this_type_does_not_support_comparisons;
-    }
-	bool operator !() { return Empty(); }
-#endif
+	explicit operator bool() { return !Empty(); }
 
 private:
 	// Prevent copying objects
-	MulticastDelegateSafe1(const MulticastDelegateSafe1&);
-	MulticastDelegateSafe1& operator=(const MulticastDelegateSafe1&);
+	MulticastDelegateSafe(const MulticastDelegateSafe&);
+	MulticastDelegateSafe& operator=(const MulticastDelegateSafe&);
 
-	/// Lock to make the class thread-safe
-	LOCK m_lock;
-};
+	enum { NO_INVOCATION = ~size_t(0) };
 
-template<typename Param1, typename Param2>
-class MulticastDelegateSafe2 : public MulticastDelegate2<Param1, Param2>
-{
-public:
-	MulticastDelegateSafe2() { LockGuard::Create(&m_lock); }
-	~MulticastDelegateSafe2() { LockGuard::Destroy(&m_lock); }
+	/// An invocation list entry
+	struct Invocation
+	{
+		Invocation() : coalesce(0), priority(PRIORITY_NORMAL), first(false), next(NO_INVOCATION) { }
 
-	void operator+=(const Delegate2<Param1, Param2>& delegate) { 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate2<Param1, Param2>::operator +=(delegate); 
-	}
-	void operator-=(const Delegate2<Param1, Param2>& delegate)	{ 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate2<Param1, Param2>::operator -=(delegate); 
-	}
-	void operator()(Param1 p1, Param2 p2) {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate2<Param1, Param2>::operator ()(p1, p2); 
-	}
-	bool Empty() { 
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegate2<Param1, Param2>::Empty();
-	}
-	void Clear() {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate2<Param1, Param2>::Clear();
-	}
+		DelegateConnection connection;
 
-#if USE_CPLUSPLUS_11
-	explicit operator bool() {
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegateBase::operator bool();
-	}
-#else
-	operator typename MulticastDelegate2<Param1, Param2>::bool_type() {
-		return Empty()? 0 : &MulticastDelegateBase::this_type_does_not_support_comparisons;
-    }
-	bool operator !() { return Empty(); }
-#endif
+		/// The delegate, if its messages may be shared, otherwise 0
+		DelegateAsyncCoalesce<Args...>* coalesce;
 
-private:
-	// Prevent copying objects
-	MulticastDelegateSafe2(const MulticastDelegateSafe2&);
-	MulticastDelegateSafe2& operator=(const MulticastDelegateSafe2&);
+		/// The delegate's default priority
+		DelegatePriority priority;
 
-	/// Lock to make the class thread-safe
-	LOCK m_lock;
-};
+		/// True for the first entry of each group sharing a thread and priority
+		bool first;
 
-template<typename Param1, typename Param2, typename Param3>
-class MulticastDelegateSafe3 : public MulticastDelegate3<Param1, Param2, Param3>
-{
-public:
-	MulticastDelegateSafe3() { LockGuard::Create(&m_lock); }
-	~MulticastDelegateSafe3() { LockGuard::Destroy(&m_lock); }
+		/// The index of the next entry in the group, or NO_INVOCATION
+		size_t next;
+	};
 
-	void operator+=(const Delegate3<Param1, Param2, Param3>& delegate) { 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate3<Param1, Param2, Param3>::operator +=(delegate); 
-	}
-	void operator-=(const Delegate3<Param1, Param2, Param3>& delegate)	{ 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate3<Param1, Param2, Param3>::operator -=(delegate); 
-	}
-	void operator()(Param1 p1, Param2 p2, Param3 p3) {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate3<Param1, Param2, Param3>::operator ()(p1, p2, p3); 
-	}
-	bool Empty() { 
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegate3<Param1, Param2, Param3>::Empty();
-	}
-	void Clear() {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate3<Param1, Param2, Param3>::Clear();
-	}
+	/// An immutable invocation list. Never empty; an empty container holds 
+	/// a null list.
+	typedef std::vector<Invocation> InvocationList;
+	typedef std::shared_ptr<const InvocationList> InvocationListPtr;
 
-#if USE_CPLUSPLUS_11
-	explicit operator bool() {
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegateBase::operator bool();
-	}
-#else
-	operator typename MulticastDelegate3<Param1, Param2, Param3>::bool_type() {
-		return Empty()? 0 : &MulticastDelegateBase::this_type_does_not_support_comparisons;
-    }
-	bool operator !() { return Empty(); }
+	/// @brief A message holding one copy of the arguments that invokes a group 
+	/// of delegates on their thread. Keeps the invocation list it came from alive.
+	class CoalescedMsg final : public IDelegateInvoker, public DelegateMsg<DelegateSharedArg, Args...>
+	{
+#if USE_DELEGATE_POOLS
+		DELEGATE_POOL(CoalescedMsg)
 #endif
-
-private:
-	// Prevent copying objects
-	MulticastDelegateSafe3(const MulticastDelegateSafe3&);
-	MulticastDelegateSafe3& operator=(const MulticastDelegateSafe3&);
-
-	/// Lock to make the class thread-safe
+	public:
+		CoalescedMsg(const InvocationListPtr& list, size_t first, Args... args) :
+			DelegateMsg<DelegateSharedArg, Args...>(this, std::forward<Args>(args)...),
+			m_list(list),
+			m_first(first)
+		{
+		}
+
+		/// Called by the target thread to invoke the group's target functions
+		virtual void DelegateInvoke(DelegateMsgBase** msg) {
+			if (!this->IsDiscarded()) {
+				for (size_t i = m_first; i != NO_INVOCATION; i = (*m_list)[i].next) {
+					const Invocation& invocation = (*m_list)[i];
+					if (invocation.connection.IsConnected()) {
+						Target target = { invocation.coalesce };
+						this->template Call<void>(target);
+					}
+				}
+			}
+
+			*msg = 0;
+			delete this;
+		}
+
+	private:
+		/// Calls a target function with the message's arguments
+		struct Target
+		{
+			DelegateAsyncCoalesce<Args...>* delegate;
+			void operator()(Args... args) { delegate->InvokeTarget(std::forward<Args>(args)...); }
+		};
+
+		InvocationListPtr m_list;
+		size_t m_first;
+	};
+
+	/// Copy the connected entries of a list. 
+	/// @param[in] list - the list to copy, or null.
+	/// @param[in] reserve - extra capacity to reserve.
+	/// @return The new list, or null if no entries were copied and none reserved.
+	static std::shared_ptr<InvocationList> Copy(const InvocationListPtr& list, size_t reserve) {
+		std::shared_ptr<InvocationList> newList = std::make_shared<InvocationList>();
+		if (list) {
+			newList->reserve(list->size() + reserve);
+			for (size_t i = 0; i < list->size(); i++) {
+				if ((*list)[i].connection.IsConnected())
+					newList->push_back((*list)[i]);
+			}
+		}
+		if (newList->empty() && reserve == 0)
+			newList.reset();
+		else
+			Link(*newList);
+		return newList;
+	}
+
+	/// Group the entries whose messages may be shared by thread and priority, 
+	/// linking each group's entries in order.
+	static void Link(InvocationList& list) {
+		std::vector<size_t> lasts;
+		for (size_t i = 0; i < list.size(); i++) {
+			Invocation& invocation = list[i];
+			invocation.first = false;
+			invocation.next = NO_INVOCATION;
+			if (!invocation.coalesce)
+				continue;
+
+			size_t group = 0;
+			while (group < lasts.size() && 
+				(list[lasts[group]].coalesce->GetThread() != invocation.coalesce->GetThread() ||
+				list[lasts[group]].priority != invocation.priority))
+				group++;
+
+			if (group == lasts.size()) {
+				invocation.first = true;
+				lasts.push_back(i);
+			}
+			else {
+				list[lasts[group]].next = i;
+				lasts[group] = i;
+			}
+		}
+	}
+
+	InvocationListPtr Load() const { return std::atomic_load(&m_list); }
+	void Store(InvocationListPtr list) { std::atomic_store(&m_list, list); }
+
+	/// The current invocation list. Only accessed with std::atomic_load() and 
+	/// std::atomic_store().
+	InvocationListPtr m_list;
+
+	/// Lock serializing writers of m_list
 	LOCK m_lock;
-};
-
-template<typename Param1, typename Param2, typename Param3, typename Param4>
-class MulticastDelegateSafe4 : public MulticastDelegate4<Param1, Param2, Param3, Param4>
-{
-public:
-	MulticastDelegateSafe4() { LockGuard::Create(&m_lock); }
-	~MulticastDelegateSafe4() { LockGuard::Destroy(&m_lock); }
-
-	void operator+=(const Delegate4<Param1, Param2, Param3, Param4>& delegate) { 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate4<Param1, Param2, Param3, Param4>::operator +=(delegate); 
-	}
-	void operator-=(const Delegate4<Param1, Param2, Param3, Param4>& delegate)	{ 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate4<Param1, Param2, Param3, Param4>::operator -=(delegate); 
-	}
-	void operator()(Param1 p1, Param2 p2, Param3 p3, Param4 p4) {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate4<Param1, Param2, Param3, Param4>::operator ()(p1, p2, p3, p4); 
-	}
-	bool Empty() { 
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegate4<Param1, Param2, Param3, Param4>::Empty();
-	}
-	void Clear() {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate4<Param1, Param2, Param3, Param4>::Clear();
-	}
 
-#if USE_CPLUSPLUS_11
-	explicit operator bool() {
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegateBase::operator bool();
-	}
-#else
-	operator typename MulticastDelegate4<Param1, Param2, Param3, Param4>::bool_type() {
-		return Empty()? 0 : &MulticastDelegateBase::this_type_does_not_support_comparisons;
-    }
-	bool operator !() { return Empty(); }
-#endif
-
-private:
-	// Prevent copying objects
-	MulticastDelegateSafe4(const MulticastDelegateSafe4&);
-	MulticastDelegateSafe4& operator=(const MulticastDelegateSafe4&);
-
-	/// Lock to make the class thread-safe
-	LOCK m_lock;
+	/// Set to share messages between delegates bound to the same thread
+	std::atomic<bool> m_coalesce;
 };
 
-template<typename Param1, typename Param2, typename Param3, typename Param4, typename Param5>
-class MulticastDelegateSafe5 : public MulticastDelegate5<Param1, Param2, Param3, Param4, Param5>
-{
-public:
-	MulticastDelegateSafe5() { LockGuard::Create(&m_lock); }
-	~MulticastDelegateSafe5() { LockGuard::Destroy(&m_lock); }
-
-	void operator+=(const Delegate5<Param1, Param2, Param3, Param4, Param5>& delegate) { 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate5<Param1, Param2, Param3, Param4, Param5>::operator +=(delegate); 
-	}
-	void operator-=(const Delegate5<Param1, Param2, Param3, Param4, Param5>& delegate)	{ 
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate5<Param1, Param2, Param3, Param4, Param5>::operator -=(delegate); 
-	}
-	void operator()(Param1 p1, Param2 p2, Param3 p3, Param4 p4, Param5 p5) {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate5<Param1, Param2, Param3, Param4, Param5>::operator ()(p1, p2, p3, p4, p5); 
-	}
-	bool Empty() { 
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegate5<Param1, Param2, Param3, Param4, Param5>::Empty();
-	}
-	void Clear() {
-		LockGuard lockGuard(&m_lock);
-		MulticastDelegate5<Param1, Param2, Param3, Param4, Param5>::Clear();
-	}
-
-#if USE_CPLUSPLUS_11
-	explicit operator bool() {
-		LockGuard lockGuard(&m_lock);
-		return MulticastDelegateBase::operator bool();
-	}
-#else
-	operator typename MulticastDelegate5<Param1, Param2, Param3, Param4, Param5>::bool_type() {
-		return Empty()? 0 : &MulticastDelegateBase::this_type_does_not_support_comparisons;
-    }
-	bool operator !() { return Empty(); }
-#endif
-
-private:
-	// Prevent copying objects
-	MulticastDelegateSafe5(const MulticastDelegateSafe5&);
-	MulticastDelegateSafe5& operator=(const MulticastDelegateSafe5&);
-
-	/// Lock to make the class thread-safe
-	LOCK m_lock;
-};
+// The MulticastDelegateSafeN names of the earlier fixed arity classes
+typedef MulticastDelegateSafe<void()> MulticastDelegateSafe0;
+template <class Param1> 
+using MulticastDelegateSafe1 = MulticastDelegateSafe<void(Param1)>;
+template <class Param1, class Param2> 
+using MulticastDelegateSafe2 = MulticastDelegateSafe<void(Param1, Param2)>;
+template <class Param1, class Param2, class Param3> 
+using MulticastDelegateSafe3 = MulticastDelegateSafe<void(Param1, Param2, Param3)>;
+template <class Param1, class Param2, class Param3, class Param4> 
+using MulticastDelegateSafe4 = MulticastDelegateSafe<void(Param1, Param2, Param3, Param4)>;
+template <class Param1, class Param2, class Param3, class Param4, class Param5> 
+using MulticastDelegateSafe5 = MulticastDelegateSafe<void(Param1, Param2, Param3, Param4, Param5)>;
 
 }
 
@@ -3,6 +3,9 @@
 #include "Fault.h"
 #include <cstring>
 #include <iostream>
+#if _MSC_VER
+	#include <intrin.h>
+#endif
 
 using namespace std;
 
@@ -20,6 +23,17 @@ using namespace std;
 #endif
 static BOOL _xallocInitialized = FALSE;
 
+// Block sizes are rounded up to a size class. Above MIN_BLOCK_SIZE there are two 
+// classes per power of two, 2^k and 1.5 * 2^k (16, 24, 32, 48, 64, 96, ...), so 
+// at most a third of a block is wasted. _sizeClasses maps a class index directly 
+// to the allocator handling it. The SMALL_CLASSES classes, blocks up to 4096 bytes, 
+// are created by xalloc_init(); larger ones are created on first use.
+#define MIN_BLOCK_SHIFT		4
+#define MIN_BLOCK_SIZE		(1 << MIN_BLOCK_SHIFT)
+#define MAX_SIZE_CLASSES	(2 * (sizeof(size_t) * CHAR_BIT - MIN_BLOCK_SHIFT) + 1)
+#define SMALL_CLASSES		17
+static Allocator* _sizeClasses[MAX_SIZE_CLASSES];
+
 // Define STATIC_POOLS to switch from heap blocks mode to static pools mode
 //#define STATIC_POOLS 
 #ifdef STATIC_POOLS
@@ -46,10 +60,44 @@ static BOOL _xallocInitialized = FALSE;
 	static Allocator* _allocators[MAX_ALLOCATORS];
 
 #else
-	#define MAX_ALLOCATORS  15
+	#define MAX_ALLOCATORS  MAX_SIZE_CLASSES
 	static Allocator* _allocators[MAX_ALLOCATORS];
 #endif	// STATIC_POOLS
 
+// Each thread caches free blocks per block size so most xmalloc() and xfree() 
+// calls don't take the lock. A thread refills its cache from the shared allocator, 
+// and returns blocks to it, CACHE_BATCH blocks at a time. Only the first 
+// CACHE_CLASSES size classes are cached. Not used with STATIC_POOLS, where a cache 
+// could hold blocks a fixed size pool needs elsewhere. Blocks held in a cache are 
+// reported as in use by xalloc_stats().
+//
+// A cached block freed on a thread other than the one that allocated it is pushed
+// onto the allocating thread's lock-free remote list. The owner takes the whole 
+// list back when it runs out of blocks, so producer/consumer pipelines recycle 
+// blocks without the lock. A thread's cache outlives the thread, and is reused by
+// the next thread to start, since blocks allocated from it may still be in use.
+#if !defined(STATIC_POOLS) && (__GNUC__ >= 5 || _MSC_VER >= 1900)
+	#define THREAD_CACHE
+	#define CACHE_BATCH				32
+	#define CACHE_CLASSES			SMALL_CLASSES
+
+	#include <atomic>
+	class ThreadCache;
+
+	/// @brief A ThreadCache free-list for one size class. A block allocated from a
+	/// thread cache stores its CacheList, tagged by setting the low bit, in place 
+	/// of the Allocator*, so xfree() can tell which thread cache it belongs to.
+	struct CacheList
+	{
+		Allocator* allocator;
+		ThreadCache* owner;
+		void* head;
+		UINT count;
+	};
+
+	static void destroy_thread_caches();
+#endif
+
 // For C++ applications, must define AUTOMATIC_XALLOCATOR_INIT_DESTROY to 
 // correctly ensure allocators are initialized before any static user C++ 
 // construtor/destructor executes which might call into the xallocator API. 
@@ -80,17 +128,54 @@ XallocInitDestroy::~XallocInitDestroy()
 }
 #endif	// AUTOMATIC_XALLOCATOR_INIT_DESTROY
 
-/// Returns the next higher powers of two. For instance, pass in 12 and 
-/// the value returned would be 16. 
-/// @param[in] k - numeric value to compute the next higher power of two.
-/// @return	The next higher power of two based on the input k. 
-template <class T>
-T nexthigher(T k) 
+/// Returns the index of the most significant set bit. For instance, pass in 12 
+/// and the value returned would be 3. 
+/// @param[in] k - numeric value, must not be 0.
+/// @return	The bit index of the highest set bit in k.
+static inline INT bit_scan_reverse(size_t k)
+{
+#if __GNUC__
+	return (INT)(sizeof(unsigned long long) * CHAR_BIT - 1) - __builtin_clzll(k);
+#elif _MSC_VER && _WIN64
+	unsigned long index;
+	_BitScanReverse64(&index, k);
+	return (INT)index;
+#elif _MSC_VER
+	unsigned long index;
+	_BitScanReverse(&index, k);
+	return (INT)index;
+#else
+	INT index = 0;
+	while (k >>= 1)
+		index++;
+	return index;
+#endif
+}
+
+/// Get the size class index for a block size.
+/// @param[in] blockSize - the block size, including the Allocator* stored within the block.
+/// @return The index of the smallest size class holding blockSize bytes.
+static inline INT get_size_class(size_t blockSize)
 {
-    k--;
-    for (size_t i=1; i<sizeof(T)*CHAR_BIT; i<<=1)
-        k |= (k >> i);
-    return k+1;
+	if (blockSize <= MIN_BLOCK_SIZE)
+		return 0;
+
+	// 2^k < blockSize <= 2^(k+1). Choose between 1.5 * 2^k and 2^(k+1).
+	INT k = bit_scan_reverse(blockSize - 1);
+	size_t oneAndHalf = (size_t)3 << (k - 1);
+	return 2 * (k - MIN_BLOCK_SHIFT) + (blockSize > oneAndHalf ? 2 : 1);
+}
+
+/// Get the block size of a size class.
+/// @param[in] sizeClass - the size class index.
+/// @return The size class block size in bytes.
+static inline size_t get_class_block_size(INT sizeClass)
+{
+	if (sizeClass == 0)
+		return MIN_BLOCK_SIZE;
+
+	INT k = MIN_BLOCK_SHIFT + (sizeClass - 1) / 2;
+	return (sizeClass & 1) ? ((size_t)3 << (k - 1)) : ((size_t)1 << (k + 1));
 }
 
 /// Create the xallocator lock. Call only one time at startup. 
@@ -167,6 +252,13 @@ static inline Allocator* get_block_allocator(void* block)
 	// Back up one Allocator* position to get the stored allocator instance
 	pAllocatorInBlock--;
 
+#ifdef THREAD_CACHE
+	// A thread cache's block stores a tagged CacheList instead
+	size_t header = (size_t)*pAllocatorInBlock;
+	if (header & 1)
+		return ((CacheList*)(header & ~(size_t)1))->allocator;
+#endif
+
 	// Return the allocator instance stored within the memory block
 	return *pAllocatorInBlock;
 }
@@ -183,24 +275,6 @@ static inline void *get_block_ptr(void* block)
 	return --pAllocatorInBlock;
 }
 
-/// Returns an allocator instance matching the size provided
-/// @param[in] size - allocator block size
-/// @return Allocator instance handling requested block size or NULL
-/// if no allocator exists. 
-static inline Allocator* find_allocator(size_t size)
-{
-	for (INT i=0; i<MAX_ALLOCATORS; i++)
-	{
-		if (_allocators[i] == 0)
-			break;
-		
-		if (_allocators[i]->GetBlockSize() == size)
-			return _allocators[i];
-	}
-	
-	return NULL;
-}
-
 /// Insert an allocator instance into the array
 /// @param[in] allocator - An allocator instance
 static inline void insert_allocator(Allocator* allocator)
@@ -253,6 +327,23 @@ extern "C" void xalloc_init()
 	_allocators[9] = (Allocator*)&_allocator1024;
 	_allocators[10] = (Allocator*)&_allocator2048;
 	_allocators[11] = (Allocator*)&_allocator4096;
+
+	// Map each size class to the smallest pool its blocks fit in 
+	for (INT c=0, i=0; c<(INT)MAX_SIZE_CLASSES; c++)
+	{
+		while (i < MAX_ALLOCATORS && _allocators[i]->GetBlockSize() < get_class_block_size(c))
+			i++;
+		if (i == MAX_ALLOCATORS)
+			break;
+		_sizeClasses[c] = _allocators[i];
+	}
+#else
+	// Create the small size classes up front
+	for (INT c=0; c<SMALL_CLASSES; c++)
+	{
+		_sizeClasses[c] = new Allocator(get_class_block_size(c), 0, 0, "xallocator");
+		insert_allocator(_sizeClasses[c]);
+	}
 #endif
 }
 
@@ -260,6 +351,10 @@ extern "C" void xalloc_init()
 /// ~XallocInitDestroy destructor calls this function automatically. 
 extern "C" void xalloc_destroy()
 {
+#ifdef THREAD_CACHE
+	destroy_thread_caches();
+#endif
+
 	lock_get();
 
 #ifdef STATIC_POOLS
@@ -277,6 +372,8 @@ extern "C" void xalloc_destroy()
 		_allocators[i] = 0;
 	}
 #endif
+	for (INT c=0; c<(INT)MAX_SIZE_CLASSES; c++)
+		_sizeClasses[c] = 0;
 
 	lock_release();
 
@@ -291,29 +388,20 @@ extern "C" void xalloc_destroy()
 ///	size.
 extern "C" Allocator* xallocator_get_allocator(size_t size)
 {
-	// Based on the size, find the next higher powers of two value.
-	// Add sizeof(Allocator*) to the requested block size to hold the size
-	// within the block memory region. Most blocks are powers of two,
-	// however some common allocator block sizes can be explicitly defined
-	// to minimize wasted storage. This offers application specific tuning.
-	size_t blockSize = size + sizeof(Allocator*);
-	if (blockSize > 256 && blockSize <= 396)
-		blockSize = 396;
-	else if (blockSize > 512 && blockSize <= 768)
-		blockSize = 768;
-	else
-		blockSize = nexthigher<size_t>(blockSize);
-
-	Allocator* allocator = find_allocator(blockSize);
+	// Add sizeof(Allocator*) to the requested block size to hold the 
+	// allocator within the block memory region
+	INT sizeClass = get_size_class(size + sizeof(Allocator*));
+	Allocator* allocator = _sizeClasses[sizeClass];
 
 #ifdef STATIC_POOLS
 	ASSERT_TRUE(allocator != NULL);
 #else
-	// If there is not an allocator already created to handle this block size
+	// If there is not an allocator already created to handle this size class
 	if (allocator == NULL)  
 	{
 		// Create a new allocator to handle blocks of the size required
-		allocator = new Allocator(blockSize, 0, 0, "xallocator");
+		allocator = new Allocator(get_class_block_size(sizeClass), 0, 0, "xallocator");
+		_sizeClasses[sizeClass] = allocator;
 
 		// Insert allocator into array
 		insert_allocator(allocator);
@@ -323,17 +411,295 @@ extern "C" Allocator* xallocator_get_allocator(size_t size)
 	return allocator;
 }
 
+#ifdef THREAD_CACHE
+/// @brief One thread's cache of free blocks, one free-list per size class. Only 
+/// the owning thread touches the free-lists so no lock is needed, except to refill 
+/// from or flush to the shared allocators. Other threads return blocks through 
+/// the lock-free remote list.
+class ThreadCache
+{
+public:
+	/// Get a cache for the calling thread, reusing one released by an exited thread
+	static ThreadCache* Acquire()
+	{
+		lock_get();
+		ThreadCache* cache = m_caches;
+		while (cache != NULL && cache->m_inUse)
+			cache = cache->m_next;
+		if (cache == NULL)
+		{
+			cache = new ThreadCache();
+			cache->m_next = m_caches;
+			m_caches = cache;
+		}
+		cache->m_inUse = TRUE;
+		lock_release();
+		return cache;
+	}
+
+	/// Return every cached block to the shared allocators when the thread exits.
+	/// Blocks freed to the cache later wait on its remote list.
+	static void Release(ThreadCache* cache)
+	{
+		cache->Reclaim();
+		for (INT i=0; i<CACHE_CLASSES; i++)
+			cache->Flush(cache->m_lists[i], cache->m_lists[i].count);
+
+		lock_get();
+		cache->m_inUse = FALSE;
+		lock_release();
+	}
+
+	/// Return every block to the shared allocators and delete every cache
+	static void DestroyAll()
+	{
+		while (m_caches != NULL)
+		{
+			ThreadCache* cache = m_caches;
+			m_caches = cache->m_next;
+			Release(cache);
+			delete cache;
+		}
+	}
+
+	/// Get a raw block for the client's requested size
+	/// @param[in] size - the client requested size of the block.
+	/// @param[out] list - the free-list the block belongs to.
+	/// @return A raw block, or NULL if the size is not cached. 
+	void* Allocate(size_t size, CacheList*& list)
+	{
+		INT sizeClass = get_size_class(size + sizeof(Allocator*));
+		if (sizeClass >= CACHE_CLASSES)
+			return NULL;
+
+		list = &m_lists[sizeClass];
+		if (list->head == NULL)
+		{
+			// Take back blocks other threads freed before locking the shared allocator
+			if (m_remote.load(std::memory_order_relaxed) != NULL)
+				Reclaim();
+			if (list->head == NULL)
+				Refill(*list, size);
+		}
+
+		Block* block = static_cast<Block*>(list->head);
+		list->head = block->next;
+		list->count--;
+		return block;
+	}
+
+	/// Take back a raw block on the thread owning the cache
+	/// @param[in] list - the free-list the block belongs to.
+	/// @param[in] block - the raw block.
+	void Deallocate(CacheList& list, void* block)
+	{
+		Block* pBlock = static_cast<Block*>(block);
+		pBlock->next = static_cast<Block*>(list.head);
+		list.head = pBlock;
+
+		// Hand a batch back to the shared allocator once the list grows too long
+		if (++list.count >= CACHE_BATCH * 2)
+			Flush(list, CACHE_BATCH);
+	}
+
+	/// A block on its way back to the owner. The tagged CacheList stays in the 
+	/// first word so the owner can find the free-list to return it to.
+	struct RemoteBlock
+	{
+		void* header;
+		RemoteBlock* next;
+	};
+
+	/// Take back a chain of raw blocks on any other thread
+	/// @param[in] first - the first block, linked through RemoteBlock::next.
+	/// @param[in] last - the last block in the chain.
+	void DeallocateRemote(RemoteBlock* first, RemoteBlock* last)
+	{
+		RemoteBlock* head = m_remote.load(std::memory_order_relaxed);
+		do
+		{
+			last->next = head;
+		} while (!m_remote.compare_exchange_weak(head, first, 
+			std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	/// Get the cache's free-list a block belongs to
+	/// @param[in] header - the value stored in the block in place of the Allocator*.
+	/// @return The free-list, or NULL if the block is not from a thread cache.
+	static CacheList* GetList(void* header)
+	{
+		size_t value = (size_t)header;
+		return (value & 1) ? (CacheList*)(value & ~(size_t)1) : NULL;
+	}
+
+	/// Get the value stored in a block in place of the Allocator*
+	static void* GetHeader(CacheList* list) { return (void*)((size_t)list | 1); }
+
+private:
+	ThreadCache() : m_remote(NULL), m_next(NULL), m_inUse(FALSE)
+	{
+		for (INT i=0; i<CACHE_CLASSES; i++)
+		{
+			m_lists[i].allocator = NULL;
+			m_lists[i].owner = this;
+			m_lists[i].head = NULL;
+			m_lists[i].count = 0;
+		}
+	}
+
+	struct Block
+	{
+		Block* next;
+	};
+
+	/// Move every block on the remote list to its free-list. Only the owner
+	/// takes the list, so a single exchange removes it without ABA hazards. 
+	void Reclaim()
+	{
+		RemoteBlock* block = m_remote.exchange(NULL, std::memory_order_acquire);
+		while (block != NULL)
+		{
+			RemoteBlock* next = block->next;
+			Deallocate(*GetList(block->header), block);
+			block = next;
+		}
+	}
+
+	/// Fill the list with a batch of blocks from the shared allocator
+	void Refill(CacheList& list, size_t size)
+	{
+		lock_get();
+
+		// Set once; other threads read it to find a cached block's allocator
+		if (list.allocator == NULL)
+			list.allocator = xallocator_get_allocator(size);
+		for (INT i=0; i<CACHE_BATCH; i++)
+		{
+			Block* block = static_cast<Block*>(list.allocator->Allocate(list.allocator->GetBlockSize()));
+			block->next = static_cast<Block*>(list.head);
+			list.head = block;
+		}
+
+		lock_release();
+
+		list.count += CACHE_BATCH;
+	}
+
+	/// Return up to cnt blocks from the list to the shared allocator
+	void Flush(CacheList& list, UINT cnt)
+	{
+		lock_get();
+		for (UINT i=0; i<cnt && list.head; i++)
+		{
+			Block* block = static_cast<Block*>(list.head);
+			list.head = block->next;
+			list.count--;
+			list.allocator->Deallocate(block);
+		}
+		lock_release();
+	}
+
+	CacheList m_lists[CACHE_CLASSES];
+	std::atomic<RemoteBlock*> m_remote;
+	ThreadCache* m_next;
+	BOOL m_inUse;
+
+	/// Every cache, protected by the lock
+	static ThreadCache* m_caches;
+};
+
+ThreadCache* ThreadCache::m_caches = NULL;
+
+/// @brief Acquires a ThreadCache on a thread's first xmalloc() and releases it 
+/// when the thread exits. Also collects blocks freed on this thread that another
+/// thread's cache owns, so CACHE_BATCH of them are returned with one atomic push.
+class ThreadCacheRef
+{
+public:
+	ThreadCacheRef() : m_cache(NULL), m_remoteOwner(NULL), m_remoteFirst(NULL), 
+		m_remoteLast(NULL), m_remoteCount(0) { }
+	~ThreadCacheRef()
+	{
+		FlushRemote();
+		if (m_cache != NULL)
+			ThreadCache::Release(m_cache);
+	}
+
+	ThreadCache* Get()
+	{
+		if (m_cache == NULL)
+			m_cache = ThreadCache::Acquire();
+		return m_cache;
+	}
+
+	BOOL Owns(ThreadCache* cache) const { return cache == m_cache; }
+
+	/// Return a block to the cache that owns it, once a batch has collected
+	/// @param[in] owner - the cache the block belongs to.
+	/// @param[in] block - the raw block.
+	void DeallocateRemote(ThreadCache* owner, void* block)
+	{
+		if (owner != m_remoteOwner)
+		{
+			FlushRemote();
+			m_remoteOwner = owner;
+		}
+
+		ThreadCache::RemoteBlock* pBlock = static_cast<ThreadCache::RemoteBlock*>(block);
+		pBlock->next = m_remoteFirst;
+		m_remoteFirst = pBlock;
+		if (m_remoteLast == NULL)
+			m_remoteLast = pBlock;
+		if (++m_remoteCount >= CACHE_BATCH)
+			FlushRemote();
+	}
+
+private:
+	void FlushRemote()
+	{
+		if (m_remoteFirst != NULL)
+			m_remoteOwner->DeallocateRemote(m_remoteFirst, m_remoteLast);
+		m_remoteFirst = m_remoteLast = NULL;
+		m_remoteCount = 0;
+	}
+
+	ThreadCache* m_cache;
+	ThreadCache* m_remoteOwner;
+	ThreadCache::RemoteBlock* m_remoteFirst;
+	ThreadCache::RemoteBlock* m_remoteLast;
+	UINT m_remoteCount;
+};
+
+static thread_local ThreadCacheRef _threadCache;
+
+static void destroy_thread_caches()
+{
+	ThreadCache::DestroyAll();
+}
+#endif	// THREAD_CACHE
+
 /// Allocates a memory block of the requested size. The blocks are created from
 ///	the fixed block allocators.
 ///	@param[in] size - the client requested size of the block.
 /// @return	A pointer to the client's memory block.
 extern "C" void *xmalloc(size_t size)
 {
+	Allocator* allocator;
+	void* blockMemoryPtr;
+
+#ifdef THREAD_CACHE
+	// Most sizes come from the calling thread's cache without locking
+	CacheList* list;
+	blockMemoryPtr = _threadCache.Get()->Allocate(size, list);
+	if (blockMemoryPtr != NULL)
+		return set_block_allocator(blockMemoryPtr, (Allocator*)ThreadCache::GetHeader(list));
+#endif
+
 	lock_get();
 
 	// Allocate a raw memory block 
-	Allocator* allocator = xallocator_get_allocator(size);
-	void* blockMemoryPtr = allocator->Allocate(sizeof(Allocator*) + size);
+	allocator = xallocator_get_allocator(size);
+	blockMemoryPtr = allocator->Allocate(sizeof(Allocator*) + size);
 
 	lock_release();
 
@@ -350,12 +716,26 @@ extern "C" void xfree(void* ptr)
 	if (ptr == 0)
 		return;
 
-	// Extract the original allocator instance from the caller's block pointer
-	Allocator* allocator = get_block_allocator(ptr);
-
 	// Convert the client pointer into the original raw block pointer
 	void* blockPtr = get_block_ptr(ptr);
 
+#ifdef THREAD_CACHE
+	// Return a thread cache's block to that cache, through its remote list if 
+	// another thread owns it
+	CacheList* list = ThreadCache::GetList(*static_cast<void**>(blockPtr));
+	if (list != NULL)
+	{
+		if (_threadCache.Owns(list->owner))
+			list->owner->Deallocate(*list, blockPtr);
+		else
+			_threadCache.DeallocateRemote(list->owner, blockPtr);
+		return;
+	}
+#endif
+
+	// Extract the original allocator instance from the caller's block pointer
+	Allocator* allocator = get_block_allocator(ptr);
+
 	lock_get();
 
 	// Deallocate the block 
@@ -410,6 +790,12 @@ extern "C" void xalloc_stats()
 		if (_allocators[i] == 0)
 			break;
 
+#ifndef STATIC_POOLS
+		// Skip size classes created by xalloc_init() but never used
+		if (_allocators[i]->GetAllocations() == 0)
+			continue;
+#endif
+
 		if (_allocators[i]->GetName() != NULL)
 			cout << _allocators[i]->GetName();
 		cout << " Block Size: " << _allocators[i]->GetBlockSize();
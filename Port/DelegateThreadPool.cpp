@@ -0,0 +1,200 @@
+#include "DelegateOpt.h"
+#if USE_STD_THREADS
+
+#include "DelegateThreadPool.h"
+#include "Fault.h"
+
+using namespace std;
+using namespace DelegateLib;
+
+// The pool and worker index of the calling thread, if it is a pool thread
+static thread_local DelegateThreadPool* currentPool = nullptr;
+static thread_local UINT currentIndex = 0;
+
+//----------------------------------------------------------------------------
+// DelegateThreadPool
+//----------------------------------------------------------------------------
+DelegateThreadPool::DelegateThreadPool(const CHAR* poolName, UINT threadCnt) :
+	m_threadCnt(threadCnt ? threadCnt : (thread::hardware_concurrency() ? thread::hardware_concurrency() : 1)),
+	m_workers(new Worker[m_threadCnt]),
+	m_nextWorker(0),
+	m_queued(0),
+	m_sleeping(0),
+	m_exit(false),
+	m_running(false),
+	POOL_NAME(poolName)
+{
+}
+
+//----------------------------------------------------------------------------
+// ~DelegateThreadPool
+//----------------------------------------------------------------------------
+DelegateThreadPool::~DelegateThreadPool()
+{
+	ExitThreads();
+}
+
+//----------------------------------------------------------------------------
+// CreateThreads
+//----------------------------------------------------------------------------
+BOOL DelegateThreadPool::CreateThreads()
+{
+	if (!m_running)
+	{
+		m_exit = false;
+		m_running = true;
+		for (UINT i = 0; i < m_threadCnt; i++)
+			m_workers[i].thread = std::unique_ptr<std::thread>(new thread(&DelegateThreadPool::Process, this, i));
+	}
+	return TRUE;
+}
+
+//----------------------------------------------------------------------------
+// ExitThreads
+//----------------------------------------------------------------------------
+void DelegateThreadPool::ExitThreads()
+{
+	if (!m_running)
+		return;
+
+	{
+		lock_guard<mutex> lk(m_mutex);
+		m_exit = true;
+		m_cv.notify_all();
+	}
+
+	for (UINT i = 0; i < m_threadCnt; i++)
+	{
+		m_workers[i].thread->join();
+		m_workers[i].thread = nullptr;
+	}
+	m_running = false;
+}
+
+//----------------------------------------------------------------------------
+// IsPoolThread
+//----------------------------------------------------------------------------
+bool DelegateThreadPool::IsPoolThread() const
+{
+	return currentPool == this;
+}
+
+//----------------------------------------------------------------------------
+// DispatchDelegate
+//----------------------------------------------------------------------------
+bool DelegateThreadPool::DispatchDelegate(DelegateLib::DelegateMsgBase* msg)
+{
+	ASSERT_TRUE(m_running);
+
+	// Keep work created by a pool thread on that thread's queue
+	UINT index = (currentPool == this) ? currentIndex : (m_nextWorker++ % m_threadCnt);
+
+	Worker& worker = m_workers[index];
+	{
+		lock_guard<mutex> lk(worker.lock);
+		worker.queue.Push(msg);
+		worker.cnt++;
+		m_queued++;
+	}
+
+	// Only take the pool lock if a worker is parked. The sequentially consistent
+	// increment of m_queued above pairs with a worker's increment of m_sleeping
+	// and its m_queued check so the wakeup cannot be lost.
+	if (m_sleeping.load() > 0)
+	{
+		lock_guard<mutex> lk(m_mutex);
+		m_cv.notify_one();
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+// PopLocal
+//----------------------------------------------------------------------------
+DelegateMsgBase* DelegateThreadPool::PopLocal(UINT index)
+{
+	Worker& worker = m_workers[index];
+	lock_guard<mutex> lk(worker.lock);
+	QueueNode* node = worker.queue.Pop();
+	if (node)
+	{
+		worker.cnt--;
+		m_queued--;
+	}
+	return static_cast<DelegateMsgBase*>(node);
+}
+
+//----------------------------------------------------------------------------
+// Steal
+//----------------------------------------------------------------------------
+DelegateMsgBase* DelegateThreadPool::Steal(UINT index)
+{
+	for (UINT i = 1; i < m_threadCnt; i++)
+	{
+		Worker& victim = m_workers[(index + i) % m_threadCnt];
+
+		// Take the larger half of the victim's queue under one lock. A lone 
+		// message queued behind a busy victim is taken too.
+		IntrusiveQueue stolen;
+		size_t stolenCnt = 0;
+		{
+			lock_guard<mutex> lk(victim.lock);
+			if (victim.cnt == 0)
+				continue;
+			stolenCnt = (victim.cnt + 1) / 2;
+			stolen.Splice(victim.queue, stolenCnt);
+			victim.cnt -= stolenCnt;
+		}
+
+		// Run the first stolen message now and queue the rest locally
+		QueueNode* first = stolen.Pop();
+		m_queued--;
+		if (!stolen.Empty())
+		{
+			Worker& worker = m_workers[index];
+			lock_guard<mutex> lk(worker.lock);
+			worker.queue.Splice(stolen, 0);
+			worker.cnt += stolenCnt - 1;
+		}
+		return static_cast<DelegateMsgBase*>(first);
+	}
+	return nullptr;
+}
+
+//----------------------------------------------------------------------------
+// Process
+//----------------------------------------------------------------------------
+void DelegateThreadPool::Process(UINT index)
+{
+	currentPool = this;
+	currentIndex = index;
+
+	while (1)
+	{
+		DelegateMsgBase* msg = PopLocal(index);
+		if (!msg)
+			msg = Steal(index);
+
+		if (msg)
+		{
+			// Invoke the callback on this pool thread
+			msg->GetDelegateInvoker()->DelegateInvoke(&msg);
+			continue;
+		}
+
+		// Nothing to run. Park until a message is dispatched or the pool exits.
+		unique_lock<mutex> lk(m_mutex);
+		m_sleeping++;
+		while (m_queued.load() == 0 && !m_exit)
+			m_cv.wait(lk);
+		m_sleeping--;
+
+		// Exit only once every pending message has been run
+		if (m_exit && m_queued.load() == 0)
+			break;
+	}
+
+	currentPool = nullptr;
+}
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef _DELEGATE_THREAD_POOL_H
+#define _DELEGATE_THREAD_POOL_H
+
+#include "DelegateOpt.h"
+#if USE_STD_THREADS
+
+#include "DelegateThread.h"
+#include "MpscQueue.h"
+#include "DataTypes.h"
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <string>
+
+/// @brief A DelegateThread that runs delegates on a pool of worker threads.
+///
+/// Each worker owns a queue. Messages dispatched from a pool thread go to that
+/// thread's own queue; messages from any other thread are spread round-robin.
+/// A worker that runs out of work steals half of another worker's queue, so
+/// asynchronous delegate targets scale across cores without caller changes.
+///
+/// Unlike WorkerThread, delegates sent to a pool may run concurrently and out
+/// of order. Use a DelegateStrand on top of the pool where order matters.
+/// Message priority is ignored.
+class DelegateThreadPool : public DelegateLib::DelegateThread
+{
+public:
+	/// Constructor
+	/// @param[in] poolName - the pool name
+	/// @param[in] threadCnt - the number of worker threads. 0 uses one per core.
+	DelegateThreadPool(const CHAR* poolName, UINT threadCnt = 0);
+
+	/// Destructor
+	~DelegateThreadPool();
+
+	/// Called once to create the worker threads
+	/// @return TRUE if threads are created. FALSE otherise.
+	BOOL CreateThreads();
+
+	/// Called once a program exit to exit the worker threads. Pending messages
+	/// are run before the threads exit.
+	void ExitThreads();
+
+	/// Get the number of worker threads in the pool
+	UINT GetThreadCount() const { return m_threadCnt; }
+
+	/// Returns true if the calling thread is one of this pool's worker threads
+	bool IsPoolThread() const;
+
+	virtual bool DispatchDelegate(DelegateLib::DelegateMsgBase* msg);
+
+private:
+	DelegateThreadPool(const DelegateThreadPool&) = delete;
+	DelegateThreadPool& operator=(const DelegateThreadPool&) = delete;
+
+	/// One pool thread and the queue it owns
+	struct Worker
+	{
+		Worker() : cnt(0) { }
+		std::unique_ptr<std::thread> thread;
+		std::mutex lock;
+		DelegateLib::IntrusiveQueue queue;
+		size_t cnt;
+	};
+
+	/// Entry point for each worker thread
+	void Process(UINT index);
+
+	/// Remove a message from the worker's own queue
+	DelegateLib::DelegateMsgBase* PopLocal(UINT index);
+
+	/// Move the larger half of another worker's queue into this worker's queue
+	/// @return The first stolen message, or NULL if no work was found.
+	DelegateLib::DelegateMsgBase* Steal(UINT index);
+
+	const UINT m_threadCnt;
+	std::unique_ptr<Worker[]> m_workers;
+
+	/// Round-robin index for messages dispatched from outside the pool
+	std::atomic<UINT> m_nextWorker;
+
+	/// Total messages queued across all workers
+	std::atomic<size_t> m_queued;
+
+	/// Number of workers parked waiting for work
+	std::atomic<UINT> m_sleeping;
+
+	std::atomic<bool> m_exit;
+	bool m_running;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	const std::string POOL_NAME;
+};
+
+#endif
+
+#endif
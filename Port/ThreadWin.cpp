@@ -3,7 +3,6 @@
 
 #include "ThreadWin.h"
 #include "UserMsgs.h"
-#include "ThreadMsg.h"
 #include "Fault.h"
 
 HANDLE ThreadWin::m_hStartAllThreads = INVALID_HANDLE_VALUE;
@@ -59,13 +58,12 @@ void ThreadWin::PostThreadMessage(UINT msg, void* data)
 //----------------------------------------------------------------------------
 // DispatchDelegate
 //----------------------------------------------------------------------------
-void ThreadWin::DispatchDelegate(DelegateLib::DelegateMsgBase* msg)
+bool ThreadWin::DispatchDelegate(DelegateLib::DelegateMsgBase* msg)
 {
-	// Create a new ThreadMsg
-	ThreadMsg* threadMsg = new ThreadMsg(WM_DISPATCH_DELEGATE, msg);
-
-	// Post the message to the this thread's message queue
-	PostThreadMessage(WM_DISPATCH_DELEGATE, threadMsg);
+	// Post the message to the this thread's message queue. The delegate message
+	// is passed directly in the wParam value; no wrapper is allocated.
+	PostThreadMessage(WM_DISPATCH_DELEGATE, msg);
+	return true;
 }
 
 //----------------------------------------------------------------------------
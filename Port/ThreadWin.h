@@ -87,7 +87,7 @@ private:
 	ThreadWin& operator=(const ThreadWin&);
 
 	/// @see DelegateThread::DispatchDelegate
-	virtual void DispatchDelegate(DelegateLib::DelegateMsgBase* msg);
+	virtual bool DispatchDelegate(DelegateLib::DelegateMsgBase* msg);
 
 	/// The thread start routine. 
 	/// @param[in] threadParam - the thread data passed into the function. 
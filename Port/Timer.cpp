@@ -1,26 +1,39 @@
 #include "Timer.h"
 #include "Fault.h"
+#if USE_STD_THREADS
+	#include "WorkerThreadStd.h"
+#endif
 #include <chrono>
 
 using namespace std;
 
 LOCK Timer::m_lock;
 bool Timer::m_lockInit = false;
-bool Timer::m_timerStopped = false;
-list<Timer*> Timer::m_timers;
+TimerWheel Timer::m_wheel(Timer::GetTime());
+Timer* Timer::m_callback = NULL;
+std::thread::id Timer::m_callbackThread;
 
-//------------------------------------------------------------------------------
-// TimerDisabled
-//------------------------------------------------------------------------------
-static bool TimerDisabled (Timer* value)
+#if USE_STD_THREADS
+std::thread* Timer::m_serviceThread = NULL;
+std::condition_variable Timer::m_serviceCv;
+bool Timer::m_serviceExit = false;
+
+/// Stops the timer service thread at program exit. Defined after the static
+/// members above so it is destroyed before them.
+struct TimerServiceExit
 {
-	return !(value->Enabled());
-}
+	~TimerServiceExit() { Timer::StopService(); }
+};
+static TimerServiceExit timerServiceExit;
+#endif
 
 //------------------------------------------------------------------------------
 // Constructor
 //------------------------------------------------------------------------------
 Timer::Timer() 
+#if USE_STD_THREADS
+	: m_thread(NULL)
+#endif
 {
 	// Create the thread mutex
 	if (m_lockInit == false)
@@ -33,13 +46,20 @@ Timer::Timer()
 	m_enabled = false;
 }
 
+#if USE_STD_THREADS
+Timer::Timer(WorkerThread& thread) :
+	m_thread(&thread),
+	m_enabled(false)
+{
+}
+#endif
+
 //------------------------------------------------------------------------------
 // Destructor
 //------------------------------------------------------------------------------
 Timer::~Timer()
 {
-	LockGuard lockGuard(&m_lock);
-	m_timers.remove(this);
+	Stop();
 }
 
 //------------------------------------------------------------------------------
@@ -47,18 +67,25 @@ Timer::~Timer()
 //------------------------------------------------------------------------------
 void Timer::Start(unsigned long timeout)
 {
-	LockGuard lockGuard(&m_lock);
-
-	m_timeout = timeout;
-    ASSERT_TRUE(m_timeout != 0);
-	m_expireTime = GetTime();
-	m_enabled = true;
+#if USE_STD_THREADS
+	if (m_thread)
+	{
+		// Only the target thread's lock is taken
+		lock_guard<mutex> lk(m_thread->m_mutex);
+		Schedule(m_thread->m_timerWheel, timeout);
+		m_thread->TimerScheduled();
+		return;
+	}
+#endif
 
-	// Remove the existing entry, if any, to prevent duplicates in the list
-	m_timers.remove(this);
+	LockGuard lockGuard(&m_lock);
+	Schedule(m_wheel, timeout);
 
-	// Add this timer to the list for servicing
-	m_timers.push_back(this);
+#if USE_STD_THREADS
+	// Wake the service thread to account for the new deadline
+	StartService();
+	m_serviceCv.notify_one();
+#endif
 }
 
 //------------------------------------------------------------------------------
@@ -66,37 +93,69 @@ void Timer::Start(unsigned long timeout)
 //------------------------------------------------------------------------------
 void Timer::Stop()
 {
-	LockGuard lockGuard(&m_lock);
+	// Wait for a callback running on another thread to return. Unlink on each 
+	// pass since the callback may restart the timer.
+#if USE_STD_THREADS
+	if (m_thread)
+	{
+		unique_lock<mutex> lk(m_thread->m_mutex);
+		for (;;)
+		{
+			m_enabled = false;
+			Unlink();
+			if (m_thread->m_timerCallback != this || 
+				m_thread->GetThreadId() == this_thread::get_id())
+				return;
+			lk.unlock();
+			this_thread::yield();
+			lk.lock();
+		}
+	}
+#endif
 
-	m_enabled = false;
-	m_timerStopped = true;
+	for (;;)
+	{
+		{
+			LockGuard lockGuard(&m_lock);
+			m_enabled = false;
+			Unlink();
+			if (m_callback != this || m_callbackThread == this_thread::get_id())
+				return;
+		}
+		this_thread::yield();
+	}
 }
 
 //------------------------------------------------------------------------------
-// CheckExpired
+// Schedule
 //------------------------------------------------------------------------------
-void Timer::CheckExpired()
+void Timer::Schedule(TimerWheel& wheel, unsigned long timeout)
 {
-	if (!m_enabled)
-		return;
+	m_timeout = timeout;
+    ASSERT_TRUE(m_timeout != 0);
+	m_expireTime = GetTime();
+	m_enabled = true;
 
-	// Has the timer expired?
-    if (Difference(m_expireTime, GetTime()) < m_timeout)
-        return;
+	// Schedule moves the timer if it is already started
+	wheel.Schedule(this, m_expireTime + m_timeout);
+}
 
+//------------------------------------------------------------------------------
+// Reschedule
+//------------------------------------------------------------------------------
+void Timer::Reschedule(TimerWheel& wheel, unsigned long now)
+{
     // Increment the timer to the next expiration
 	m_expireTime += m_timeout;
 
 	// Is the timer already expired after we incremented above?
-    if (Difference(m_expireTime, GetTime()) > m_timeout)
+    if (Difference(m_expireTime, now) > m_timeout)
 	{
 		// The timer has fallen behind so set time expiration further forward.
-		m_expireTime = GetTime();
+		m_expireTime = now;
 	}
 
-	// Call the client's expired callback function
-	if (Expired)
-		Expired();
+	wheel.Schedule(this, m_expireTime + m_timeout);
 }
 
 //------------------------------------------------------------------------------
@@ -112,29 +171,147 @@ unsigned long Timer::Difference(unsigned long time1, unsigned long time2)
 //------------------------------------------------------------------------------
 void Timer::ProcessTimers()
 {
-	LockGuard lockGuard(&m_lock);
+	ServiceTimers();
+}
+
+//------------------------------------------------------------------------------
+// ServiceTimers
+//------------------------------------------------------------------------------
+void Timer::ServiceTimers()
+{
+	// Collect every timer due by now. Stopped timers are not on the wheel.
+	unsigned long now = GetTime();
+	TimerWheelList expired;
+	{
+		LockGuard lockGuard(&m_lock);
+		m_wheel.Advance(now, expired);
+	}
+
+	// A timer stopped or destroyed by an earlier callback is unlinked from 
+	// expired under the lock, so it is never seen here.
+	for (;;)
+	{
+		Timer* timer;
+		{
+			LockGuard lockGuard(&m_lock);
+			TimerWheelNode* node = expired.PopFront();
+			if (node == NULL)
+				break;
+
+			// Reschedule before the callback, which may stop or restart the timer
+			timer = static_cast<Timer*>(node);
+			timer->Reschedule(m_wheel, now);
+
+			// Stop() and the destructor wait while m_callback is the timer
+			m_callback = timer;
+			m_callbackThread = this_thread::get_id();
+		}
+
+		// Call the client's expired callback function without the lock, so it 
+		// may start or stop any timer and a slow callback blocks no other thread
+		if (timer->Expired)
+			timer->Expired();
+
+		// The timer may be destroyed by its own callback; do not touch it
+		LockGuard lockGuard(&m_lock);
+		m_callback = NULL;
+	}
+}
 
-	// Remove disabled timer from the list if stopped
-	if (m_timerStopped)
+#if USE_STD_THREADS
+//------------------------------------------------------------------------------
+// ExpireTimers
+//------------------------------------------------------------------------------
+void Timer::ExpireTimers(WorkerThread& thread, std::unique_lock<std::mutex>& lk)
+{
+	TimerWheel& wheel = thread.m_timerWheel;
+	unsigned long now = GetTime();
+	TimerWheelList expired;
+	wheel.Advance(now, expired);
+
+	// A timer stopped or destroyed by an earlier callback is unlinked from 
+	// expired under the lock, so it is never seen here.
+	TimerWheelNode* node;
+	while ((node = expired.PopFront()) != NULL)
 	{
-		m_timers.remove_if(TimerDisabled);
-		m_timerStopped = false;
+		Timer* timer = static_cast<Timer*>(node);
+		timer->Reschedule(wheel, now);
+
+		// Stop() and the destructor on another thread wait for the callback
+		thread.m_timerCallback = timer;
+		lk.unlock();
+		if (timer->Expired)
+			timer->Expired();
+		lk.lock();
+		thread.m_timerCallback = NULL;
 	}
+}
 
-	// Iterate through each timer and check for expirations
-	TimersIterator it;
-	for (it = m_timers.begin() ; it != m_timers.end(); it++ )
+//------------------------------------------------------------------------------
+// StartService
+//------------------------------------------------------------------------------
+void Timer::StartService()
+{
+	if (m_serviceThread == NULL)
 	{
-		if ((*it) != NULL)
-			(*it)->CheckExpired();
+		m_serviceExit = false;
+		m_serviceThread = new std::thread(&Timer::ServiceThread);
 	}
 }
 
+//------------------------------------------------------------------------------
+// StopService
+//------------------------------------------------------------------------------
+void Timer::StopService()
+{
+	std::thread* serviceThread;
+	{
+		LockGuard lockGuard(&m_lock);
+		serviceThread = m_serviceThread;
+		m_serviceThread = NULL;
+		m_serviceExit = true;
+		m_serviceCv.notify_one();
+	}
+
+	if (serviceThread)
+	{
+		serviceThread->join();
+		delete serviceThread;
+	}
+}
+
+//------------------------------------------------------------------------------
+// ServiceThread
+//------------------------------------------------------------------------------
+void Timer::ServiceThread()
+{
+	for (;;)
+	{
+		ServiceTimers();
+
+		// Sleep until the next timer is due or a timer is started. The wheel is 
+		// checked under the lock since the callbacks may have changed it.
+		std::unique_lock<LOCK> lk(m_lock);
+		if (m_serviceExit)
+			break;
+		unsigned long next = m_wheel.NextEvent();
+		if (next == 0)
+			m_serviceCv.wait(lk);
+		else
+			m_serviceCv.wait_for(lk, std::chrono::milliseconds(next));
+	}
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GetTime
+//------------------------------------------------------------------------------
 unsigned long Timer::GetTime()
 {
-    auto milliseconds_since_epoch =
+	// A monotonic clock so a wall clock change cannot move every deadline
+    auto milliseconds =
         std::chrono::duration_cast<std::chrono::milliseconds>
-        (std::chrono::system_clock::now().time_since_epoch()).count();
-    return (unsigned long)milliseconds_since_epoch;
+        (std::chrono::steady_clock::now().time_since_epoch()).count();
+    return (unsigned long)milliseconds;
 }
 
@@ -3,29 +3,63 @@
 
 #include "DelegateLib.h"
 #include "LockGuard.h"
-#include <list>
+#include "TimerWheel.h"
+#include <thread>
+#if USE_STD_THREADS
+	#include <mutex>
+	#include <condition_variable>
+#endif
 
 using namespace DelegateLib;
 
+#if USE_STD_THREADS
+class WorkerThread;
+#endif
+
 /// @brief A timer class provides periodic timer callbacks on the client's 
 /// thread of control. Timer is thread safe.
-class Timer 
+///
+/// Timers are kept on a hierarchical timing wheel with one tick per millisecond.
+/// Start(), Stop() and expiring a timer are O(1) regardless of how many timers
+/// exist, and a service pass only touches the timers that are due.
+///
+/// With USE_STD_THREADS a timer constructed with a WorkerThread expires on 
+/// that thread. The worker keeps its own wheel and services it between 
+/// messages, so Expired runs directly in the thread's loop without a message 
+/// dispatch or any lock shared with other threads. Any other timer is serviced 
+/// by a single timer service thread, started by the first call to Start(). 
+/// Both sleep until the next timer is due rather than polling. Other ports 
+/// call ProcessTimers() periodically. 
+class Timer : private TimerWheelNode
 {
 public:
-	/// Client's register with Expired to get timer callbacks
+	/// Client's register with Expired to get timer callbacks. The delegate is
+	/// invoked on the thread servicing the timer; bind the timer to a thread, 
+	/// or register an asynchronous delegate, to receive the callback on a 
+	/// specific thread. 
 	SinglecastDelegate0<void> Expired;
 
 	/// Constructor
 	Timer(void);
 
-	/// Destructor
+#if USE_STD_THREADS
+	/// Constructor. The timer expires on the given thread, which must outlive it.
+	/// Expired is invoked synchronously on that thread.
+	/// @param[in] thread - the thread to invoke Expired on.
+	explicit Timer(WorkerThread& thread);
+#endif
+
+	/// Destructor. Stops the timer, see Stop().
 	~Timer(void);
 
 	/// Starts a timer for callbacks on the specified timeout interval.
 	/// @param[in]	timeout - the timeout in milliseconds.
 	void Start(unsigned long timeout);
 
-	/// Stops a timer.
+	/// Stops a timer. If another thread is running the timer's Expired callback,
+	/// waits for it to return, so the timer may then be destroyed. Do not call
+	/// while holding a lock that callback needs. Stopping the timer from its 
+	/// own callback does not wait.
 	void Stop();
 
 	/// Gets the enabled state of a timer.
@@ -43,7 +77,9 @@ public:
 	/// @return		The time difference in ticks.
 	static unsigned long Difference(unsigned long time1, unsigned long time2);
 
-	/// Called on a periodic basic to service all timer instances. 
+	/// Called on a periodic basic to service all timer instances. Not required
+	/// with USE_STD_THREADS where the timer service thread does this. Call from
+	/// one thread only.
 	static void ProcessTimers();
 
 private:
@@ -51,12 +87,46 @@ private:
 	Timer(const Timer&);
 	Timer& operator=(const Timer&);
 
-	/// Called to check for expired timers and callback registered clients.
-	void CheckExpired();
+	/// Set the timeout and schedule the first expiry. Called with the wheel's lock held.
+	void Schedule(TimerWheel& wheel, unsigned long timeout);
+
+	/// Schedule the timer's next expiry after it expires. Called with the 
+	/// wheel's lock held, before the client's callback is invoked.
+	/// @param[in] wheel - the wheel the timer is on.
+	/// @param[in] now - the current time in ticks.
+	void Reschedule(TimerWheel& wheel, unsigned long now);
+
+	/// Service all timers. Called without m_lock held; each Expired callback 
+	/// is invoked with the lock released so it may start, stop or destroy timers.
+	static void ServiceTimers();
+
+#if USE_STD_THREADS
+	friend class WorkerThread;
+
+	/// Expire the due timers of a WorkerThread's wheel. Each Expired callback 
+	/// is invoked with the lock released so it may start, stop or destroy timers.
+	/// @param[in] thread - the thread owning the wheel.
+	/// @param[in] lk - a lock on the thread's mutex guarding the wheel.
+	static void ExpireTimers(WorkerThread& thread, std::unique_lock<std::mutex>& lk);
 
-	/// List of all system timers to be serviced.
-	static std::list<Timer*> m_timers;
-	typedef std::list<Timer*>::iterator TimersIterator;
+	/// Entry point for the timer service thread
+	static void ServiceThread();
+
+	/// Start the timer service thread if not already running. Called with m_lock held.
+	static void StartService();
+
+	/// Stop the timer service thread. Called at program exit.
+	static void StopService();
+
+	friend struct TimerServiceExit;
+
+	static std::thread* m_serviceThread;
+	static std::condition_variable m_serviceCv;
+	static bool m_serviceExit;
+#endif
+
+	/// Every started timer, ordered by expiry time.
+	static TimerWheel m_wheel;
 
 	/// A lock to make this class thread safe.
 	static LOCK m_lock;
@@ -64,10 +134,19 @@ private:
 	/// TRUE if lock initialized.
 	static bool m_lockInit;
 
+	/// The timer whose Expired callback ServiceTimers() is running, or NULL, 
+	/// and the thread running it. Guarded by m_lock.
+	static Timer* m_callback;
+	static std::thread::id m_callbackThread;
+
+#if USE_STD_THREADS
+	/// The thread the timer expires on, or NULL for the timer service thread
+	WorkerThread* const m_thread;
+#endif
+
 	unsigned long m_timeout;		// in ticks
 	unsigned long m_expireTime;		// in ticks
 	bool m_enabled;
-	static bool m_timerStopped;
 };
 
 #endif
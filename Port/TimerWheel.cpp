@@ -0,0 +1,244 @@
+#include "TimerWheel.h"
+#include "Fault.h"
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+//------------------------------------------------------------------------------
+// LowestBit
+//------------------------------------------------------------------------------
+/// Get the index of the lowest set bit. bits must be non-zero.
+static UINT LowestBit(UINT64 bits)
+{
+#if defined(__GNUC__)
+	return (UINT)__builtin_ctzll(bits);
+#elif defined(_MSC_VER) && defined(_WIN64)
+	unsigned long index;
+	_BitScanForward64(&index, bits);
+	return (UINT)index;
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, (unsigned long)bits))
+		return (UINT)index;
+	_BitScanForward(&index, (unsigned long)(bits >> 32));
+	return (UINT)index + 32;
+#else
+	UINT index = 0;
+	while (!(bits & 1))
+	{
+		bits >>= 1;
+		index++;
+	}
+	return index;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Unlink
+//------------------------------------------------------------------------------
+void TimerWheelNode::Unlink()
+{
+	if (!m_next)
+		return;
+	m_prev->m_next = m_next;
+	m_next->m_prev = m_prev;
+	m_prev = m_next = NULL;
+}
+
+//------------------------------------------------------------------------------
+// PushBack
+//------------------------------------------------------------------------------
+void TimerWheelList::PushBack(TimerWheelNode* node)
+{
+	ASSERT_TRUE(!node->IsLinked());
+	node->m_prev = m_head.m_prev;
+	node->m_next = &m_head;
+	m_head.m_prev->m_next = node;
+	m_head.m_prev = node;
+}
+
+//------------------------------------------------------------------------------
+// PopFront
+//------------------------------------------------------------------------------
+TimerWheelNode* TimerWheelList::PopFront()
+{
+	if (Empty())
+		return NULL;
+	TimerWheelNode* node = m_head.m_next;
+	node->Unlink();
+	return node;
+}
+
+//------------------------------------------------------------------------------
+// Splice
+//------------------------------------------------------------------------------
+void TimerWheelList::Splice(TimerWheelList& src)
+{
+	if (src.Empty())
+		return;
+
+	TimerWheelNode* first = src.m_head.m_next;
+	TimerWheelNode* last = src.m_head.m_prev;
+	src.m_head.m_prev = src.m_head.m_next = &src.m_head;
+
+	first->m_prev = m_head.m_prev;
+	last->m_next = &m_head;
+	m_head.m_prev->m_next = first;
+	m_head.m_prev = last;
+}
+
+//------------------------------------------------------------------------------
+// Clear
+//------------------------------------------------------------------------------
+void TimerWheelList::Clear()
+{
+	while (PopFront())
+		;
+}
+
+//------------------------------------------------------------------------------
+// TimerWheel
+//------------------------------------------------------------------------------
+TimerWheel::TimerWheel(unsigned long now) :
+	m_now(now)
+{
+	for (int level = 0; level < LEVELS; level++)
+		m_occupied[level] = 0;
+}
+
+//------------------------------------------------------------------------------
+// Schedule
+//------------------------------------------------------------------------------
+void TimerWheel::Schedule(TimerWheelNode* node, unsigned long expire)
+{
+	node->Unlink();
+	node->m_expire = expire;
+
+	// This tick's slot has already expired. Expire a due node on the next tick.
+	unsigned long delta = expire - m_now;
+	if (delta == 0 || (long)delta < 0)
+	{
+		UINT index = SlotIndex(m_now + 1, 0);
+		m_slots[0][index].PushBack(node);
+		m_occupied[0] |= (UINT64)1 << index;
+		return;
+	}
+	Place(node);
+}
+
+//------------------------------------------------------------------------------
+// Place
+//------------------------------------------------------------------------------
+void TimerWheel::Place(TimerWheelNode* node)
+{
+	unsigned long delta = node->m_expire - m_now;
+
+	int level = 0;
+	while (level < LEVELS - 1 && delta >= (1UL << ((level + 1) * SLOT_BITS)))
+		level++;
+
+	UINT index;
+	if (delta >= (1UL << (LEVELS * SLOT_BITS)))
+	{
+		// Beyond the wheel's range. Park in the top level slot that comes due
+		// last; the node is placed again from there.
+		index = SlotIndex(m_now, level);
+	}
+	else
+		index = SlotIndex(node->m_expire, level);
+
+	m_slots[level][index].PushBack(node);
+	m_occupied[level] |= (UINT64)1 << index;
+}
+
+//------------------------------------------------------------------------------
+// Tick
+//------------------------------------------------------------------------------
+void TimerWheel::Tick(TimerWheelList& expired)
+{
+	m_now++;
+
+	// At the start of each revolution of a level, move the nodes in the next
+	// slot of the level above down. Work from the top so a node can move down
+	// several levels at once.
+	for (int level = LEVELS - 1; level > 0; level--)
+	{
+		unsigned long lowerMask = (1UL << (level * SLOT_BITS)) - 1;
+		if ((m_now & lowerMask) != 0)
+			continue;
+
+		UINT index = SlotIndex(m_now, level);
+		if (!(m_occupied[level] & ((UINT64)1 << index)))
+			continue;
+
+		TimerWheelList cascade;
+		cascade.Splice(m_slots[level][index]);
+		m_occupied[level] &= ~((UINT64)1 << index);
+
+		TimerWheelNode* node;
+		while ((node = cascade.PopFront()) != NULL)
+			Place(node);
+	}
+
+	// Everything in this tick's level 0 slot has expired
+	UINT index = SlotIndex(m_now, 0);
+	expired.Splice(m_slots[0][index]);
+	m_occupied[0] &= ~((UINT64)1 << index);
+}
+
+//------------------------------------------------------------------------------
+// Advance
+//------------------------------------------------------------------------------
+void TimerWheel::Advance(unsigned long now, TimerWheelList& expired)
+{
+	while (m_now != now)
+	{
+		// Skip straight to the next tick with work to do
+		unsigned long next = NextEvent();
+		if (next == 0 || next > now - m_now)
+		{
+			m_now = now;
+			break;
+		}
+		m_now += next - 1;
+		Tick(expired);
+	}
+}
+
+//------------------------------------------------------------------------------
+// NextOccupied
+//------------------------------------------------------------------------------
+UINT TimerWheel::NextOccupied(int level, UINT from) const
+{
+	UINT64 bits = m_occupied[level];
+	if (!bits)
+		return 0;
+
+	// Rotate so the slot after from is bit 0
+	UINT shift = (from + 1) & SLOT_MASK;
+	if (shift)
+		bits = (bits >> shift) | (bits << (SLOTS - shift));
+	return LowestBit(bits) + 1;
+}
+
+//------------------------------------------------------------------------------
+// NextEvent
+//------------------------------------------------------------------------------
+unsigned long TimerWheel::NextEvent() const
+{
+	unsigned long next = 0;
+	for (int level = 0; level < LEVELS; level++)
+	{
+		UINT slots = NextOccupied(level, SlotIndex(m_now, level));
+		if (!slots)
+			continue;
+
+		// Level 0 slots expire on their tick. Higher level slots are moved down
+		// at the start of their span.
+		int shift = level * SLOT_BITS;
+		unsigned long due = (((m_now >> shift) + slots) << shift) - m_now;
+		if (next == 0 || due < next)
+			next = due;
+	}
+	return next;
+}
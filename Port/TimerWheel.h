@@ -0,0 +1,138 @@
+#ifndef _TIMER_WHEEL_H
+#define _TIMER_WHEEL_H
+
+#include "DataTypes.h"
+
+class TimerWheel;
+
+/// @brief Intrusive link for an object scheduled on a TimerWheel. A node is
+/// on at most one wheel at a time.
+class TimerWheelNode
+{
+public:
+	TimerWheelNode() : m_prev(NULL), m_next(NULL), m_expire(0) { }
+
+	/// Returns true if the node is scheduled on a wheel or held in an expired list
+	bool IsLinked() const { return m_next != NULL; }
+
+	/// Get the tick the node is scheduled to expire at
+	unsigned long GetExpire() const { return m_expire; }
+
+	/// Remove the node from whichever list holds it. Does nothing if not linked.
+	void Unlink();
+
+private:
+	friend class TimerWheel;
+	friend class TimerWheelList;
+
+	// Prevent copying objects
+	TimerWheelNode(const TimerWheelNode&);
+	TimerWheelNode& operator=(const TimerWheelNode&);
+
+	TimerWheelNode* m_prev;
+	TimerWheelNode* m_next;
+	unsigned long m_expire;
+};
+
+/// @brief A circular, doubly linked list of TimerWheelNode instances. Insert
+/// and remove are O(1). Not thread-safe.
+class TimerWheelList
+{
+public:
+	TimerWheelList() { m_head.m_prev = m_head.m_next = &m_head; }
+	~TimerWheelList() { Clear(); }
+
+	/// Returns true if no nodes are in the list
+	bool Empty() const { return m_head.m_next == &m_head; }
+
+	/// Add a node to the back of the list
+	void PushBack(TimerWheelNode* node);
+
+	/// Remove the node at the front of the list
+	/// @return The front node, or NULL if the list is empty.
+	TimerWheelNode* PopFront();
+
+	/// Move every node of another list to the back of this list in O(1)
+	void Splice(TimerWheelList& src);
+
+	/// Unlink every node
+	void Clear();
+
+private:
+	// Prevent copying objects
+	TimerWheelList(const TimerWheelList&);
+	TimerWheelList& operator=(const TimerWheelList&);
+
+	/// Sentinel node. Never unlinked.
+	TimerWheelNode m_head;
+};
+
+/// @brief A hierarchical timing wheel. Schedule(), TimerWheelNode::Unlink()
+/// and expiring a node are O(1), independent of how many nodes are scheduled.
+///
+/// The wheel has LEVELS levels of SLOTS slots. Level 0 slots are one tick
+/// wide, and each higher level's slots span a whole revolution of the level
+/// below. A node is placed on the lowest level whose range covers its expiry
+/// and moves down a level each time the slot it is in comes due, reaching
+/// level 0 in the tick before it expires. Deadlines beyond the top level are
+/// parked in its furthest slot and re-placed when that slot comes due.
+///
+/// Not thread-safe; the owner provides any locking.
+class TimerWheel
+{
+public:
+	/// Constructor
+	/// @param[in] now - the current tick.
+	explicit TimerWheel(unsigned long now);
+
+	/// Schedule a node. A node already scheduled is moved.
+	/// @param[in] node - the node to schedule.
+	/// @param[in] expire - the tick to expire at. A tick at or before the
+	///		wheel's current tick expires on the next call to Advance().
+	void Schedule(TimerWheelNode* node, unsigned long expire);
+
+	/// Advance the wheel's current tick, collecting every node that expires.
+	/// @param[in] now - the new current tick.
+	/// @param[out] expired - receives the expired nodes in expiry order.
+	void Advance(unsigned long now, TimerWheelList& expired);
+
+	/// Get the ticks until the wheel next needs to be advanced: when the next
+	/// node expires, or sooner if a higher level slot must first be moved down.
+	/// @return The ticks from the current tick, or 0 if nothing is scheduled.
+	unsigned long NextEvent() const;
+
+	/// Get the wheel's current tick
+	unsigned long GetNow() const { return m_now; }
+
+private:
+	// Prevent copying objects
+	TimerWheel(const TimerWheel&);
+	TimerWheel& operator=(const TimerWheel&);
+
+	enum { SLOT_BITS = 6, SLOTS = 1 << SLOT_BITS, SLOT_MASK = SLOTS - 1, LEVELS = 4 };
+
+	/// Place a node in the slot for its expiry relative to m_now
+	void Place(TimerWheelNode* node);
+
+	/// Advance m_now by one tick, moving down and expiring nodes as required
+	void Tick(TimerWheelList& expired);
+
+	/// Get the slot index of a tick on a level
+	static UINT SlotIndex(unsigned long tick, int level)
+	{
+		return (UINT)(tick >> (level * SLOT_BITS)) & SLOT_MASK;
+	}
+
+	/// Get the number of slots from one index to the next occupied slot,
+	/// searching forward and wrapping.
+	/// @return 1 to SLOTS, or 0 if no slot on the level is occupied.
+	UINT NextOccupied(int level, UINT from) const;
+
+	unsigned long m_now;
+	TimerWheelList m_slots[LEVELS][SLOTS];
+
+	/// One bit per slot, set while the slot holds nodes
+	UINT64 m_occupied[LEVELS];
+};
+
+#endif
@@ -2,7 +2,6 @@
 #if USE_STD_THREADS
 
 #include "WorkerThreadStd.h"
-#include "ThreadMsg.h"
 #include "Timer.h"
 
 #ifdef WIN32
@@ -12,15 +11,42 @@
 using namespace std;
 using namespace DelegateLib;
 
-#define MSG_DISPATCH_DELEGATE	1
-#define MSG_EXIT_THREAD			2
-#define MSG_TIMER				3
+/// Returns true if any priority level has a message queued
+template <class Queue>
+static bool AnyQueued(const Queue* queues)
+{
+	for (int i = 0; i < PRIORITY_LEVELS; i++)
+	{
+		if (!queues[i].Empty())
+			return true;
+	}
+	return false;
+}
 
 //----------------------------------------------------------------------------
 // WorkerThread
 //----------------------------------------------------------------------------
-WorkerThread::WorkerThread(const CHAR* threadName) : m_thread(nullptr), m_timerExit(false), THREAD_NAME(threadName)
+WorkerThread::WorkerThread(const CHAR* threadName, QueueType queueType) : 
+	m_thread(nullptr), 
+	m_queueType(queueType),
+	m_maxPerDrain(1),
+	m_starvationLimit(16),
+	m_exit(false),
+	m_capacity(0),
+	m_overflowPolicy(OVERFLOW_BLOCK),
+	m_depth(0),
+	m_blocked(0),
+	m_rejectedCnt(0),
+	m_droppedCnt(0),
+	m_timerWheel(Timer::GetTime()),
+	m_timerCallback(NULL),
+	m_timerArmed(false),
+	m_timerDue(0),
+	m_waiting(false),
+	THREAD_NAME(threadName)
 {
+	for (int i = 0; i < PRIORITY_LEVELS; i++)
+		m_skipped[i] = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -56,6 +82,38 @@ BOOL WorkerThread::CreateThread()
 	return TRUE;
 }
 
+//----------------------------------------------------------------------------
+// SetBatchDrain
+//----------------------------------------------------------------------------
+void WorkerThread::SetBatchDrain(UINT maxPerDrain)
+{
+	ASSERT_TRUE(!m_thread);
+	m_maxPerDrain = maxPerDrain;
+}
+
+//----------------------------------------------------------------------------
+// SetStarvationLimit
+//----------------------------------------------------------------------------
+void WorkerThread::SetStarvationLimit(UINT limit)
+{
+	ASSERT_TRUE(!m_thread);
+	m_starvationLimit = limit;
+}
+
+//----------------------------------------------------------------------------
+// SetCapacity
+//----------------------------------------------------------------------------
+void WorkerThread::SetCapacity(size_t capacity, OverflowPolicy policy)
+{
+	ASSERT_TRUE(!m_thread);
+
+	// Producers cannot remove messages from a single-consumer lock-free queue
+	ASSERT_TRUE(!(capacity && policy == OVERFLOW_DROP_OLDEST && m_queueType == QUEUE_LOCK_FREE));
+	m_capacity = capacity;
+	m_overflowPolicy = policy;
+	m_depth = 0;
+}
+
 //----------------------------------------------------------------------------
 // GetThreadId
 //----------------------------------------------------------------------------
@@ -81,106 +139,432 @@ void WorkerThread::ExitThread()
 	if (!m_thread)
 		return;
 
-	// Create a new ThreadMsg
-	std::shared_ptr<ThreadMsg> threadMsg(new ThreadMsg(MSG_EXIT_THREAD, 0));
-
-	// Put exit thread message into the queue
+	// The worker thread exits once every pending message has run
+	m_exit = true;
+	Wake();
 	{
-		lock_guard<mutex> lock(m_mutex);
-		m_queue.push(threadMsg);
-		m_cv.notify_one();
+		// Release dispatchers blocked on a full queue
+		lock_guard<mutex> lk(m_mutex);
+		m_spaceCv.notify_all();
 	}
 
     m_thread->join();
     m_thread = nullptr;
+	m_exit = false;
+
+	// Discard any messages posted while the thread was exiting, releasing 
+	// callers waiting on them. The worker thread has exited so this thread 
+	// is now the only consumer.
+	IntrusiveQueue discarded;
+	size_t queued = 0;
+	{
+		lock_guard<mutex> lk(m_mutex);
+		discarded.Splice(m_batch, 0);
+		for (int level = 0; level < PRIORITY_LEVELS; level++)
+			queued += discarded.Splice(m_queue[level], 0);
+		ReleaseSpace(queued);
+	}
+	queued = 0;
+	for (int level = 0; level < PRIORITY_LEVELS; level++)
+	{
+		while (!m_mpscQueue[level].Empty())
+		{
+			QueueNode* node = m_mpscQueue[level].Pop();
+			if (node)
+			{
+				discarded.Push(node);
+				queued++;
+			}
+			else
+				this_thread::yield();
+		}
+	}
+	ReleaseSpace(queued);
+
+	QueueNode* node;
+	while ((node = discarded.Pop()) != nullptr)
+		DiscardMsg(static_cast<DelegateMsgBase*>(node));
 }
 
 //----------------------------------------------------------------------------
 // DispatchDelegate
 //----------------------------------------------------------------------------
-void WorkerThread::DispatchDelegate(DelegateLib::DelegateMsgBase* msg)
+bool WorkerThread::DispatchDelegate(DelegateLib::DelegateMsgBase* msg)
 {
 	ASSERT_TRUE(m_thread);
 
-	// Create a new ThreadMsg
-    std::shared_ptr<ThreadMsg> threadMsg(new ThreadMsg(MSG_DISPATCH_DELEGATE, msg));
-
-	// Add dispatch delegate msg to queue and notify worker thread
-	std::unique_lock<std::mutex> lk(m_mutex);
-	m_queue.push(threadMsg);
-	m_cv.notify_one();
+	// Add dispatch delegate msg to queue and notify worker thread. The message
+	// is the queue node so no allocation is required. 
+	return PostMsg(msg);
 }
 
 //----------------------------------------------------------------------------
-// TimerThread
+// PostMsg
 //----------------------------------------------------------------------------
-void WorkerThread::TimerThread()
+bool WorkerThread::PostMsg(DelegateMsgBase* msg)
 {
-    while (!m_timerExit)
-    {
-		std::this_thread::sleep_for((std::chrono::milliseconds)100);
+	int level = msg->GetPriority();
+	ASSERT_TRUE(level >= 0 && level < PRIORITY_LEVELS);
+
+	bool rejected = false;
+	DelegateMsgBase* dropped = nullptr;
+
+	if (m_queueType == QUEUE_LOCK_FREE)
+	{
+		// Reserve a slot before pushing so the queue never exceeds m_capacity
+		size_t depth = m_depth.load();
+		while (m_capacity && !rejected && !dropped)
+		{
+			if (depth < m_capacity)
+			{
+				if (m_depth.compare_exchange_weak(depth, depth + 1))
+					break;
+			}
+			else if (m_overflowPolicy == OVERFLOW_BLOCK)
+			{
+				unique_lock<mutex> lk(m_mutex);
+				rejected = !WaitForSpace(lk);
+				depth = m_depth.load();
+			}
+			else if (m_overflowPolicy == OVERFLOW_FAIL)
+				rejected = true;
+			else
+				dropped = msg;
+		}
 
-        std::shared_ptr<ThreadMsg> threadMsg (new ThreadMsg(MSG_TIMER, 0));
+		if (!rejected && !dropped)
+		{
+			m_mpscQueue[level].Push(msg);
+			Wake();
+		}
+	}
+	else
+	{
+		unique_lock<mutex> lk(m_mutex);
+		if (m_capacity && m_depth.load() >= m_capacity)
+		{
+			if (m_overflowPolicy == OVERFLOW_BLOCK)
+				rejected = !WaitForSpace(lk);
+			else if (m_overflowPolicy == OVERFLOW_FAIL)
+				rejected = true;
+			else if (m_overflowPolicy == OVERFLOW_DROP_NEWEST)
+				dropped = msg;
+			else
+			{
+				// Make room by removing the oldest message of the lowest priority
+				int oldest = 0;
+				while (m_queue[oldest].Empty())
+					oldest++;
+				dropped = static_cast<DelegateMsgBase*>(m_queue[oldest].Pop());
+				m_depth--;
+			}
+		}
 
-        // Add timer msg to queue and notify worker thread
-        std::unique_lock<std::mutex> lk(m_mutex);
-        m_queue.push(threadMsg);
-        m_cv.notify_one();
-    }
+		if (!rejected && dropped != msg)
+		{
+			m_queue[level].Push(msg);
+			if (m_capacity)
+				m_depth++;
+			m_cv.notify_one();
+		}
+	}
+
+	// Free rejected and dropped messages outside the lock
+	if (rejected)
+	{
+		m_rejectedCnt++;
+		DiscardMsg(msg);
+		return false;
+	}
+	if (dropped)
+	{
+		m_droppedCnt++;
+		DiscardMsg(dropped);
+	}
+	return true;
 }
 
 //----------------------------------------------------------------------------
-// Process
+// WaitForSpace
 //----------------------------------------------------------------------------
-void WorkerThread::Process()
+bool WorkerThread::WaitForSpace(unique_lock<mutex>& lk)
 {
-    m_timerExit = false;
-    std::thread timerThread(&WorkerThread::TimerThread, this);
+	// The sequentially consistent increment of m_blocked pairs with the worker's
+	// decrement of m_depth and its m_blocked check so the wakeup cannot be lost.
+	m_blocked++;
+	while (m_depth.load() >= m_capacity && !m_exit.load())
+		m_spaceCv.wait(lk);
+	m_blocked--;
+	return !m_exit.load();
+}
 
-	while (1)
+//----------------------------------------------------------------------------
+// ReleaseSpace
+//----------------------------------------------------------------------------
+void WorkerThread::ReleaseSpace(size_t cnt)
+{
+	if (!m_capacity || !cnt)
+		return;
+
+	m_depth -= cnt;
+	if (m_blocked.load() > 0)
 	{
-		std::shared_ptr<ThreadMsg> msg;
+		if (m_queueType == QUEUE_LOCK_FREE)
 		{
-			// Wait for a message to be added to the queue
-			std::unique_lock<std::mutex> lk(m_mutex);
-			while (m_queue.empty())
-				m_cv.wait(lk);
+			lock_guard<mutex> lk(m_mutex);
+			m_spaceCv.notify_all();
+		}
+		else
+			m_spaceCv.notify_all();
+	}
+}
 
-			if (m_queue.empty())
-				continue;
+//----------------------------------------------------------------------------
+// Wake
+//----------------------------------------------------------------------------
+void WorkerThread::Wake()
+{
+	if (m_queueType == QUEUE_LOCK_FREE)
+	{
+		// Only take the lock if the worker thread is parked waiting for work. 
+		// The sequentially consistent push and load pair with the worker's store 
+		// of m_waiting and its IsReady() check so the wakeup cannot be lost.
+		if (m_waiting.load())
+		{
+			lock_guard<mutex> lk(m_mutex);
+			m_cv.notify_one();
+		}
+	}
+	else
+	{
+		lock_guard<mutex> lk(m_mutex);
+		m_cv.notify_one();
+	}
+}
 
-			msg = m_queue.front();
-			m_queue.pop();
+//----------------------------------------------------------------------------
+// IsReady
+//----------------------------------------------------------------------------
+bool WorkerThread::IsReady() const
+{
+	if (m_exit.load())
+		return true;
+	if (m_queueType == QUEUE_LOCK_FREE)
+		return AnyQueued(m_mpscQueue);
+	return AnyQueued(m_queue);
+}
+
+//----------------------------------------------------------------------------
+// WaitReady
+//----------------------------------------------------------------------------
+void WorkerThread::WaitReady(unique_lock<mutex>& lk)
+{
+	while (!IsReady() && !TimersDue())
+	{
+		if (!m_timerArmed.load())
+		{
+			m_cv.wait(lk);
+			continue;
 		}
 
-		switch (msg->GetId())
+		// Sleep no longer than the next timer deadline
+		long remaining = (long)(m_timerDue.load() - Timer::GetTime());
+		if (remaining <= 0)
+			break;
+		m_cv.wait_for(lk, chrono::milliseconds(remaining));
+	}
+}
+
+//----------------------------------------------------------------------------
+// TimersDue
+//----------------------------------------------------------------------------
+bool WorkerThread::TimersDue() const
+{
+	if (!m_timerArmed.load(memory_order_relaxed))
+		return false;
+	return (long)(Timer::GetTime() - m_timerDue.load(memory_order_relaxed)) >= 0;
+}
+
+//----------------------------------------------------------------------------
+// ServiceTimers
+//----------------------------------------------------------------------------
+void WorkerThread::ServiceTimers()
+{
+	unique_lock<mutex> lk(m_mutex);
+	Timer::ExpireTimers(*this, lk);
+	TimerScheduled();
+}
+
+//----------------------------------------------------------------------------
+// TimerScheduled
+//----------------------------------------------------------------------------
+void WorkerThread::TimerScheduled()
+{
+	unsigned long next = m_timerWheel.NextEvent();
+	m_timerDue = m_timerWheel.GetNow() + next;
+	m_timerArmed = (next != 0);
+
+	// Wake the worker thread if it is parked so it waits on the new deadline
+	m_cv.notify_one();
+}
+
+//----------------------------------------------------------------------------
+// SelectLevel
+//----------------------------------------------------------------------------
+template <class Queue>
+int WorkerThread::SelectLevel(const Queue* queues)
+{
+	int top = PRIORITY_LEVELS - 1;
+	while (top >= 0 && queues[top].Empty())
+		top--;
+	if (top < 0)
+		return -1;
+
+	// Serve a lower level that has been passed over too many times
+	if (m_starvationLimit)
+	{
+		for (int level = 0; level < top; level++)
 		{
-			case MSG_DISPATCH_DELEGATE:
+			if (!queues[level].Empty() && m_skipped[level] >= m_starvationLimit)
 			{
-				ASSERT_TRUE(msg->GetData() != NULL);
+				m_skipped[level] = 0;
+				return level;
+			}
+		}
+	}
 
-				// Convert the ThreadMsg void* data back to a DelegateMsg* 
-                auto delegateMsg = static_cast<DelegateMsgBase*>(msg->GetData());
+	// Otherwise serve the highest level, noting each lower level passed over
+	for (int level = 0; level < top; level++)
+	{
+		if (!queues[level].Empty())
+			m_skipped[level]++;
+	}
+	m_skipped[top] = 0;
+	return top;
+}
 
-				// Invoke the callback on the target thread
-				delegateMsg->GetDelegateInvoker()->DelegateInvoke(&delegateMsg);
-				break;
+//----------------------------------------------------------------------------
+// DrainBatch
+//----------------------------------------------------------------------------
+void WorkerThread::DrainBatch()
+{
+	size_t room = m_maxPerDrain;
+	int level;
+	while ((level = SelectLevel(m_queue)) >= 0)
+	{
+		if (m_maxPerDrain == 0)
+		{
+			m_batch.Splice(m_queue[level], 0);
+			continue;
+		}
+
+		room -= m_batch.Splice(m_queue[level], room);
+		if (room == 0)
+			break;
+	}
+}
+
+//----------------------------------------------------------------------------
+// WaitMsg
+//----------------------------------------------------------------------------
+QueueNode* WorkerThread::WaitMsg()
+{
+	if (m_queueType == QUEUE_LOCK_FREE)
+	{
+		while (1)
+		{
+			if (TimersDue())
+				return &m_timerNode;
+
+			int level = SelectLevel(m_mpscQueue);
+			if (level >= 0)
+			{
+				QueueNode* node = m_mpscQueue[level].Pop();
+				if (node)
+				{
+					ReleaseSpace(1);
+					return node;
+				}
+
+				// A producer is part way through a push. It completes in a few instructions.
+				this_thread::yield();
+				continue;
 			}
 
-            case MSG_TIMER:
-                Timer::ProcessTimers();
-                break;
+			if (m_exit.load())
+				return &m_exitNode;
+
+			// Nothing to do. Park until a producer wakes us.
+			unique_lock<mutex> lk(m_mutex);
+			m_waiting.store(true);
+			WaitReady(lk);
+			m_waiting.store(false);
+		}
+	}
+	else
+	{
+		if (TimersDue())
+			return &m_timerNode;
+
+		// Run any messages left from the last drain before taking the lock again
+		if (!m_batch.Empty())
+			return m_batch.Pop();
+
+		// Wait for a message to be added to the queue or a timer to come due
+		unique_lock<mutex> lk(m_mutex);
+		WaitReady(lk);
+		if (TimersDue())
+			return &m_timerNode;
 
-			case MSG_EXIT_THREAD:
+		if (m_maxPerDrain == 1)
+		{
+			int level = SelectLevel(m_queue);
+			if (level >= 0)
+			{
+				ReleaseSpace(1);
+				return m_queue[level].Pop();
+			}
+		}
+		else
+		{
+			// Take up to m_maxPerDrain messages under this one lock acquisition
+			DrainBatch();
+			ReleaseSpace(m_batch.Size());
+			if (!m_batch.Empty())
 			{
-                m_timerExit = true;
-                timerThread.join();
-                return;
+				lk.unlock();
+				return m_batch.Pop();
 			}
+		}
+
+		// Nothing queued. Woken to exit.
+		return &m_exitNode;
+	}
+}
+
+//----------------------------------------------------------------------------
+// Process
+//----------------------------------------------------------------------------
+void WorkerThread::Process()
+{
+	while (1)
+	{
+		QueueNode* node = WaitMsg();
+		if (node == &m_exitNode)
+			return;
 
-			default:
-				ASSERT();
+		// Expire timers bound to this thread directly, without a dispatch
+		if (node == &m_timerNode)
+		{
+			ServiceTimers();
+			continue;
 		}
+
+		// The queue node is the delegate message
+		DelegateMsgBase* delegateMsg = static_cast<DelegateMsgBase*>(node);
+
+		// Invoke the callback on the target thread
+		delegateMsg->GetDelegateInvoker()->DelegateInvoke(&delegateMsg);
 	}
 }
 
@@ -9,19 +9,51 @@
 
 #include "DelegateThread.h"
 #include "DataTypes.h"
+#include "MpscQueue.h"
+#include "TimerWheel.h"
 #include <thread>
-#include <queue>
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
 
-class ThreadMsg;
+class Timer;
 
 class WorkerThread : public DelegateLib::DelegateThread
 {
 public:
+	/// Message queue implementation used to pass messages to the worker thread
+	enum QueueType
+	{
+		/// An intrusive queue protected by a mutex. Every dispatch takes the lock.
+		QUEUE_LOCKED,
+
+		/// A lock-free multi-producer/single-consumer queue. Producers only take 
+		/// the lock to wake the worker thread when it is parked on an empty queue.
+		QUEUE_LOCK_FREE
+	};
+
+	/// What DispatchDelegate() does when the queue is at capacity
+	enum OverflowPolicy
+	{
+		/// Block the dispatching thread until the worker thread makes room
+		OVERFLOW_BLOCK,
+
+		/// Reject the new message. DispatchDelegate() returns false and the async
+		/// delegate's IsDispatched() reports the failure to the caller.
+		OVERFLOW_FAIL,
+
+		/// Discard the oldest message of the lowest queued priority to make room. 
+		/// QUEUE_LOCKED only.
+		OVERFLOW_DROP_OLDEST,
+
+		/// Discard the new message without reporting a failure
+		OVERFLOW_DROP_NEWEST
+	};
+
 	/// Constructor
-	WorkerThread(const CHAR* threadName);
+	/// @param[in] threadName - the thread name
+	/// @param[in] queueType - the message queue implementation to use
+	WorkerThread(const CHAR* threadName, QueueType queueType = QUEUE_LOCKED);
 
 	/// Destructor
 	~WorkerThread();
@@ -39,23 +71,164 @@ public:
 	/// Get the ID of the currently executing thread
 	static std::thread::id GetCurrentThreadId();
 
-	virtual void DispatchDelegate(DelegateLib::DelegateMsgBase* msg);
+	/// Get the message queue implementation used by this thread
+	QueueType GetQueueType() const { return m_queueType; }
+
+	/// Set how many messages the worker thread removes from a QUEUE_LOCKED queue 
+	/// per lock acquisition. The batch then runs without holding the lock, so
+	/// bursty publishers contend far less with the worker. A drained batch runs 
+	/// before any higher priority message queued after it, so large batches 
+	/// trade priority latency for throughput. Call before CreateThread(). 
+	/// @param[in] maxPerDrain - the maximum messages removed per lock. 1 (the 
+	///		default) removes one message at a time. 0 swaps out the entire queue.
+	void SetBatchDrain(UINT maxPerDrain);
+
+	/// Get the maximum messages removed per lock acquisition
+	UINT GetBatchDrain() const { return m_maxPerDrain; }
+
+	/// Set how many times a non-empty lower priority queue may be passed over in 
+	/// favor of a higher priority queue before it is served once regardless. 
+	/// Bounds the starvation of low priority messages under a sustained flood of 
+	/// higher priority work. Call before CreateThread(). 
+	/// @param[in] limit - the maximum consecutive times a level is passed over. 
+	///		0 disables the guard and serves strictly by priority.
+	void SetStarvationLimit(UINT limit);
+
+	/// Get the maximum consecutive times a lower priority queue is passed over
+	UINT GetStarvationLimit() const { return m_starvationLimit; }
+
+	/// Bound the number of messages waiting in the queue. Messages removed by 
+	/// a batch drain no longer count. Call before CreateThread(). 
+	/// @param[in] capacity - the maximum queued messages. 0 (the default) is unbounded.
+	/// @param[in] policy - what to do with a message dispatched to a full queue.
+	void SetCapacity(size_t capacity, OverflowPolicy policy = OVERFLOW_BLOCK);
+
+	/// Get the maximum queued messages. 0 is unbounded.
+	size_t GetCapacity() const { return m_capacity; }
+
+	/// Get the policy applied when the queue is full
+	OverflowPolicy GetOverflowPolicy() const { return m_overflowPolicy; }
+
+	/// Get the number of messages rejected by OVERFLOW_FAIL, or by OVERFLOW_BLOCK 
+	/// when the thread exits while the dispatcher is blocked
+	size_t GetRejectedCount() const { return m_rejectedCnt; }
+
+	/// Get the number of messages discarded by OVERFLOW_DROP_OLDEST or OVERFLOW_DROP_NEWEST
+	size_t GetDroppedCount() const { return m_droppedCnt; }
+
+	virtual bool DispatchDelegate(DelegateLib::DelegateMsgBase* msg);
 
 private:
 	WorkerThread(const WorkerThread&) = delete;
 	WorkerThread& operator=(const WorkerThread&) = delete;
 
+	/// Timers bound to this thread schedule themselves on m_timerWheel
+	friend class Timer;
+
 	/// Entry point for the thread
 	void Process();
 
-    /// Entry point for timer thread
-    void TimerThread();
+	/// Add a message to the queue for its priority and wake the worker thread 
+	/// if necessary. Applies the overflow policy if the queue is full.
+	/// @return true if the message was queued or dropped, false if rejected.
+	bool PostMsg(DelegateLib::DelegateMsgBase* msg);
+
+	/// Wait for room in a full queue. 
+	/// @param[in] lk - a lock on m_mutex. 
+	/// @return false if the thread is exiting.
+	bool WaitForSpace(std::unique_lock<std::mutex>& lk);
+
+	/// Note messages removed from the queue by the worker thread and wake any 
+	/// dispatcher blocked on a full queue. Called with m_mutex held for QUEUE_LOCKED.
+	void ReleaseSpace(size_t cnt);
+
+	/// Wake the worker thread if it is parked waiting for work
+	void Wake();
+
+	/// Remove the next node from the queue, blocking until one is available.
+	/// @return The next node, m_timerNode if a bound timer is due, or m_exitNode 
+	///		once exit is requested and every queue is empty. 
+	DelegateLib::QueueNode* WaitMsg();
+
+	/// Choose the priority level to serve next. The highest non-empty level is 
+	/// chosen unless a lower non-empty level has reached the starvation limit. 
+	/// @param[in] queues - one queue per priority level.
+	/// @return The level to serve, or -1 if every queue is empty.
+	template <class Queue>
+	int SelectLevel(const Queue* queues);
+
+	/// Move up to m_maxPerDrain messages from m_queue into m_batch, highest 
+	/// priority first. Called with m_mutex held.
+	void DrainBatch();
+
+	/// Returns true if the worker thread has work to do. Called with m_mutex held.
+	bool IsReady() const;
+
+	/// Block until a message is queued, exit is requested or a timer is due.
+	/// @param[in] lk - a lock on m_mutex.
+	void WaitReady(std::unique_lock<std::mutex>& lk);
+
+	/// Returns true if a timer bound to this thread is due. Only reads the 
+	/// clock while a timer is scheduled.
+	bool TimersDue() const;
+
+	/// Expire the due timers bound to this thread. Worker thread only.
+	void ServiceTimers();
+
+	/// Note a change to m_timerWheel and wake the worker thread to account for 
+	/// a new deadline. Called with m_mutex held.
+	void TimerScheduled();
 
 	std::unique_ptr<std::thread> m_thread;
-	std::queue<std::shared_ptr<ThreadMsg>> m_queue;
+	const QueueType m_queueType;
+
+	/// Messages are queued intrusively, one queue per priority level; 
+	/// DelegateMsgBase is the queue node
+	DelegateLib::IntrusiveQueue m_queue[DelegateLib::PRIORITY_LEVELS];
+	DelegateLib::MpscQueue m_mpscQueue[DelegateLib::PRIORITY_LEVELS];
+
+	/// Messages drained from m_queue that the worker thread has yet to run, 
+	/// in the order they are to be run
+	DelegateLib::IntrusiveQueue m_batch;
+	UINT m_maxPerDrain;
+
+	/// Consecutive times each non-empty level was passed over. Worker thread only.
+	UINT m_skipped[DelegateLib::PRIORITY_LEVELS];
+	UINT m_starvationLimit;
+
+	/// Set to exit the thread once every queued message has run
+	std::atomic<bool> m_exit;
+
+	/// Queue bound. m_depth is only maintained when m_capacity is non-zero.
+	size_t m_capacity;
+	OverflowPolicy m_overflowPolicy;
+	std::atomic<size_t> m_depth;
+	std::atomic<UINT> m_blocked;
+	std::condition_variable m_spaceCv;
+	std::atomic<size_t> m_rejectedCnt;
+	std::atomic<size_t> m_droppedCnt;
+
+	/// Returned by WaitMsg() when the thread is to exit
+	DelegateLib::QueueNode m_exitNode;
+
+	/// Returned by WaitMsg() when a timer is due
+	DelegateLib::QueueNode m_timerNode;
+
+	/// Timers bound to this thread. Guarded by m_mutex.
+	TimerWheel m_timerWheel;
+
+	/// The bound timer whose Expired callback is running, or NULL. Guarded by m_mutex.
+	Timer* m_timerCallback;
+
+	/// Set while a timer is scheduled. m_timerDue is then the tick the worker 
+	/// thread next services m_timerWheel. Written with m_mutex held.
+	std::atomic<bool> m_timerArmed;
+	std::atomic<unsigned long> m_timerDue;
+
+	/// Set while the worker thread is parked on an empty QUEUE_LOCK_FREE queue
+	std::atomic<bool> m_waiting;
 	std::mutex m_mutex;
 	std::condition_variable m_cv;
-    std::atomic<bool> m_timerExit;
 	const std::string THREAD_NAME;
 };
 
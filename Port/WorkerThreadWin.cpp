@@ -2,7 +2,6 @@
 #if USE_WIN32_THREADS
 
 #include "WorkerThreadWin.h"
-#include "ThreadMsg.h"
 #include "UserMsgs.h"
 #include "Timer.h"
 
@@ -43,17 +42,11 @@ unsigned long WorkerThread::Process(void* parameter)
 			{
 				ASSERT_TRUE(msg.wParam != NULL);
 
-				// Get the ThreadMsg from the wParam value
-				ThreadMsg* threadMsg = reinterpret_cast<ThreadMsg*>(msg.wParam);
-
-				// Convert the ThreadMsg void* data back to a DelegateMsg* 
-				DelegateMsgBase* delegateMsg = static_cast<DelegateMsgBase*>(threadMsg->GetData()); 
+				// Convert the wParam value back to a DelegateMsg* 
+				DelegateMsgBase* delegateMsg = reinterpret_cast<DelegateMsgBase*>(msg.wParam); 
 
 				// Invoke the callback on the target thread
 				delegateMsg->GetDelegateInvoker()->DelegateInvoke(&delegateMsg);
-
-				// Delete dynamic data passed through message queue
-				delete threadMsg;
 				break;
 			}
 
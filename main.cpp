@@ -3,9 +3,7 @@
 #include "SysDataNoLock.h"
 #include "Timer.h"
 #include <iostream>
-#if USE_CPLUSPLUS_11
 #include <thread>
-#endif
 #if USE_STD_THREADS
 #include "WorkerThreadStd.h"
 #elif USE_WIN32_THREADS
@@ -48,7 +46,8 @@ public:
 	{
 		// Register for async delegate callbacks
 		SysData::GetInstance().SystemModeChangedDelegate += MakeDelegate(this, &SysDataClient::CallbackFunction, &workerThread1);
-		SysDataNoLock::GetInstance().SystemModeChangedDelegate += MakeDelegate(this, &SysDataClient::CallbackFunction, &workerThread1);
+		m_noLockConnection = SysDataNoLock::GetInstance().SystemModeChangedDelegate += 
+			MakeDelegate(this, &SysDataClient::CallbackFunction, &workerThread1);
 	}
 
 	~SysDataClient()
@@ -56,8 +55,9 @@ public:
 		// Unregister the all registered delegates at once
 		SysData::GetInstance().SystemModeChangedDelegate.Clear(); 
 
-		// Alternatively unregister a single delegate
-		SysDataNoLock::GetInstance().SystemModeChangedDelegate -= MakeDelegate(this, &SysDataClient::CallbackFunction, &workerThread1);
+		// Alternatively unregister a single delegate. Equivalent to:
+		// SysDataNoLock::GetInstance().SystemModeChangedDelegate -= MakeDelegate(this, &SysDataClient::CallbackFunction, &workerThread1);
+		m_noLockConnection.Disconnect();
 	}
 
 private:
@@ -68,6 +68,9 @@ private:
 	}
 
 	int m_numberOfCallbacks;
+
+	// Unregisters the SysDataNoLock delegate, at the latest when destroyed
+	ScopedDelegateConnection m_noLockConnection;
 };
 
 struct TestStruct
@@ -198,6 +201,7 @@ void TimerExpiredCb(void)
 }
 
 extern void DelegateUnitTests();
+extern void DelegateBenchmarks();
 
 //------------------------------------------------------------------------------
 // main
@@ -221,8 +225,13 @@ int main(void)
 
     // Create a timer that expires every 250mS and calls 
     // TimerExpiredCb on workerThread1 upon expiration
+#if USE_STD_THREADS
+    Timer timer(workerThread1);
+    timer.Expired = MakeDelegate(&TimerExpiredCb);
+#else
     Timer timer;
     timer.Expired = MakeDelegate(&TimerExpiredCb, &workerThread1);
+#endif
     timer.Start(250);
 
 	// Run all unit tests (uncomment to run unit tests)
@@ -230,6 +239,11 @@ int main(void)
 	DelegateUnitTests();
 #endif
 
+	// Run the benchmarks (define DELEGATE_BENCHMARKS in DelegateOpt.h)
+#if DELEGATE_BENCHMARKS
+	DelegateBenchmarks();
+#endif
+
 	// Create a delegate bound to a free function then invoke
 	DelegateFree1<int> delegateFree = MakeDelegate(&FreeFuncInt);
 	delegateFree(123);
@@ -356,18 +370,12 @@ int main(void)
 
 	// Create a asynchronous blocking delegate and invoke. This thread will block until the 
 	// msg and year stack values are set by MemberFuncStdStringRetInt on workerThread1.
-#if USE_CPLUSPLUS_11
 	auto delegateI = MakeDelegate(&testClass, &TestClass::MemberFuncStdStringRetInt, &workerThread1, WAIT_INFINITE);
-#else
-	DelegateMemberAsyncWait1<TestClass, std::string&, int> delegateI =
-		MakeDelegate(&testClass, &TestClass::MemberFuncStdStringRetInt, &workerThread1, WAIT_INFINITE);
-#endif
 	std::string msg;
 	int year = delegateI(msg);
 	if (delegateI.IsSuccess())
 		cout << msg.c_str() << " " << year << endl;
 
-#if USE_CPLUSPLUS_11
 	// Create a shared_ptr, create a delegate, then synchronously invoke delegate function
 	std::shared_ptr<TestClass> spObject(new TestClass());
 	auto delegateMemberSp = MakeDelegate(spObject, &TestClass::MemberFuncStdString);
@@ -389,7 +397,6 @@ int main(void)
 	delegateMemberSpAsync("Function async invoked using smart pointer. Bug solved!", 2016);
 	delegateMemberSpAsync.Clear();
 	testClassSp.reset();
-#endif
 
 	// Create a SysDataClient instance on the stack
 	SysDataClient sysDataClient;
@@ -415,15 +422,11 @@ int main(void)
     timer.Stop();
     timer.Expired.Clear();
 
-#ifdef USE_CPLUSPLUS_11
     std::this_thread::sleep_for(std::chrono::seconds(1));
-#endif
 
 	workerThread1.ExitThread();
 
-#ifdef USE_CPLUSPLUS_11
     std::this_thread::sleep_for(std::chrono::seconds(1));
-#endif
 
 	return 0;
 }